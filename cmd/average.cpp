@@ -92,36 +92,46 @@ EXECUTE {
   if (in_obj.is_complex()) header.data_type = DataType::CFloat32;
   else header.data_type = DataType::Float32;
 
+  // the averaging axis is the outermost loop:
+  std::vector<int> order;
+  for (int n = 0; n < in_obj.ndim(); n++) 
+    if (n != axis) order.push_back (n);
+  order.push_back (axis);
+  in_obj.stream (order);
   Image::Position in (in_obj);
   Image::Position out (*argument[1].get_image (header));
 
   float norm = 1.0 / in.dim (axis);
   const int ndim = std::min (in.ndim(), out.ndim());
-  
-  ProgressBar::init (out.voxel_count(), "averaging...");
 
-  do {
-    float re = 0.0, im = 0.0;
-
-    for (int i = 0; i < ndim; ++i) 
-      if (i != axis) 
-        in.set (i, out[i]);
-
-    for (in.set (axis,0); in[axis] < in.dim(axis); in.inc(axis)) {
-      if (geometric) re += log (in.re());
-      else {
-        re += in.re();
-        if (in.is_complex()) im += in.im();
-      }
-    }
-
-    re *= norm;
-
-    if (geometric) re = exp (re);
-    out.re (re);
-    if (in.is_complex()) out.im (norm*im);
+  // the input is read one position along the averaging axis at a time,
+  // accumulating straight into the output image, so that each part of the
+  // input is only accessed once, in order, without holding a separate copy
+  // of the output in memory:
+  ProgressBar::init (in.dim (axis), "averaging...");
+
+  for (in.set (axis,0); in[axis] < in.dim(axis); in.inc(axis)) {
+    const bool first = ( in[axis] == 0 );
+    out.zero();
+    do {
+      for (int i = 0; i < ndim; ++i) 
+        if (i != axis) 
+          in.set (i, out[i]);
+
+      float val = geometric ? log (in.re()) : in.re();
+      out.re (first ? val : out.re() + val);
+      if (in.is_complex()) out.im (first ? in.im() : out.im() + in.im());
+    } while (out++);
 
     ProgressBar::inc();
+  }
+
+  out.zero();
+  do {
+    float val = norm * out.re();
+    if (geometric) val = exp (val);
+    out.re (val);
+    if (in.is_complex()) out.im (norm*out.im());
   } while (out++);
 
   ProgressBar::done();
@@ -644,7 +644,6 @@ EXECUTE {
   Image::Object& SH_obj (*argument[2].get_image (header));
   SH_obj.map();
 
-  Glib::thread_init();
   Thread threader (sdeconv_common, dwi, mask.get(), SH_obj, bzeros, dwis, normalise);
   threader.niter = niter;
 
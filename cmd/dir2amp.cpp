@@ -23,6 +23,7 @@
 #include "app.h"
 #include "point.h"
 #include "image/position.h"
+#include "thread.h"
 
 using namespace std; 
 using namespace MR; 
@@ -43,6 +44,56 @@ ARGUMENTS = {
 OPTIONS = { Option::End };
 
 
+// computes the amplitudes a row of voxels at a time, across multiple threads:
+class Converter {
+  public:
+    Converter (Image::Object& directions, Image::Object& amplitudes) :
+      dir_obj (directions), amp_obj (amplitudes), loop (directions.dim(1)*directions.dim(2)) { }
+
+    void execute () 
+    {
+      Image::Position dir (dir_obj);
+      Image::Position amp (amp_obj);
+      gsize first, last;
+
+      while (loop.next (first, last)) {
+        for (gsize row = first; row < last; row++) {
+          dir.set (1, row % dir.dim(1)); amp.set (1, dir[1]);
+          dir.set (2, row / dir.dim(1)); amp.set (2, dir[2]);
+
+          for (dir.set(0,0), amp.set(0,0); dir[0] < dir.dim(0); dir.inc(0), amp.inc(0)) {
+            dir.set(3,0);
+            amp.set(3,0);
+
+            while (dir[3] < dir.dim(3)) {
+              Point p;
+              p[0] = dir.value(); dir.inc(3);
+              p[1] = dir.value(); dir.inc(3);
+              p[2] = dir.value(); dir.inc(3);
+
+              float amplitude = GSL_NAN;
+              if (gsl_finite (p[0]) && gsl_finite (p[1]) && gsl_finite (p[2]) && p[0] != 0.0 && p[1] != 0.0 && p[2] != 0.0) 
+                amplitude = p.norm();
+
+              amp.value (amplitude);
+              amp.inc(3);
+            }
+          }
+        }
+        progress.inc (last - first);
+      }
+    }
+
+    Thread::Progress progress;
+
+  protected:
+    Image::Object& dir_obj;
+    Image::Object& amp_obj;
+    Thread::Loop loop;
+};
+
+
+
 EXECUTE {
   Image::Object &dir_obj (*argument[0].get_image());
   Image::Header header (dir_obj);
@@ -51,37 +102,13 @@ EXECUTE {
   header.axes.set_ndim (4);
   header.axes.dim[3] = dir_obj.dim(3)/3;
 
-  Image::Position dir (dir_obj);
-  Image::Position amp (*argument[1].get_image (header));
-
-  ProgressBar::init (dir.dim(0)*dir.dim(1)*dir.dim(2), "converting orientations to amplitudes...");
+  Image::Object& amp_obj (*argument[1].get_image (header));
+  dir_obj.map();
+  amp_obj.map();
 
-  for (dir.set(2,0), amp.set(2,0); dir[2] < dir.dim(2); dir.inc(2), amp.inc(2)) {
-    for (dir.set(1,0), amp.set(1,0); dir[1] < dir.dim(1); dir.inc(1), amp.inc(1)) {
-      for (dir.set(0,0), amp.set(0,0); dir[0] < dir.dim(0); dir.inc(0), amp.inc(0)) {
-
-        dir.set(3,0);
-        amp.set(3,0);
-
-        while (dir[3] < dir.dim(3)) {
-          Point p;
-          p[0] = dir.value(); dir.inc(3);
-          p[1] = dir.value(); dir.inc(3);
-          p[2] = dir.value(); dir.inc(3);
-
-          float amplitude = GSL_NAN;
-          if (gsl_finite (p[0]) && gsl_finite (p[1]) && gsl_finite (p[2]) && p[0] != 0.0 && p[1] != 0.0 && p[2] != 0.0) 
-            amplitude = p.norm();
-
-          amp.value (amplitude);
-          amp.inc(3);
-        }
-
-        ProgressBar::inc();
-      }
-    }
-  }
+  Converter converter (dir_obj, amp_obj);
+  ProgressBar::init (dir_obj.dim(1)*dir_obj.dim(2), "converting orientations to amplitudes...");
+  Thread::run (converter);
+  converter.progress.update();
   ProgressBar::done();
 }
-
-
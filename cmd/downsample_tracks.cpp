@@ -0,0 +1,96 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+
+*/
+
+#include "app.h"
+#include "dwi/tractography/file.h"
+#include "dwi/tractography/properties.h"
+
+using namespace MR;
+using namespace MR::DWI;
+using namespace std;
+
+SET_VERSION_DEFAULT;
+
+DESCRIPTION = {
+  "reduce the size of a tracks file by removing nearly collinear points from each track.",
+  NULL
+};
+
+ARGUMENTS = {
+  Argument ("tracks", "track file", "the input track file.").type_file (),
+  Argument ("tolerance", "tolerance", "the maximum deviation allowed from the original track, in mm.").type_float (1e-6, 10.0, 0.02),
+  Argument ("output", "output file", "the output track file").type_file(),
+  Argument::End
+};
+
+
+
+OPTIONS = {
+  Option ("maxstep", "maximum step size",
+      "set the maximum distance between consecutive points retained (default is 5 times "
+      "the step size recorded in the input file, or 1 mm if none is available).")
+    .append (Argument ("distance", "distance", "the maximum distance in mm.").type_float (1e-6, 1e6, 1.0)),
+
+  Option::End
+};
+
+
+
+
+EXECUTE {
+  Tractography::Properties properties;
+  Tractography::Reader file;
+  file.open (argument[0].get_string(), properties);
+
+  const guint num_tracks = properties["count"].empty() ? 0 : to<guint> (properties["count"]);
+  const guint total_count = properties["total_count"].empty() ? 0 : to<guint> (properties["total_count"]);
+
+  // operator[] would add an empty entry to the output header if not set:
+  Tractography::Properties::const_iterator step_size = properties.find ("step_size");
+  float max_step = step_size == properties.end() || step_size->second.empty() ? 1.0 : 5.0 * to<float> (step_size->second);
+  std::vector<OptBase> opt = get_options (0); // maxstep
+  if (opt.size()) max_step = opt[0][0].get_float();
+
+  properties.erase ("count");
+  properties.erase ("total_count");
+
+  Tractography::Writer writer;
+  writer.set_downsampling (argument[1].get_float(), max_step);
+  writer.create (argument[2].get_string(), properties);
+
+  std::vector<Point> tck;
+
+  ProgressBar::init (num_tracks, "downsampling tracks...");
+
+  while (file.next (tck)) {
+    writer.append (tck);
+    ProgressBar::inc();
+  }
+
+  writer.total_count = total_count ? total_count : writer.count;
+
+  file.close();
+  writer.close();
+  ProgressBar::done();
+}
+
@@ -24,7 +24,7 @@
 */
 
 #include "app.h"
-#include "image/position.h"
+#include "image/slab_product.h"
 #include "math/linalg.h"
 #include "dwi/gradient.h"
 #include "dwi/SH.h"
@@ -134,47 +134,11 @@ EXECUTE {
   header.axes.dim[3] = DWI::SH::NforL (lmax);
   header.data_type = DataType::Float32;
 
-  Image::Position dwi (dwi_obj);
-  Image::Position sh (*argument[1].get_image (header));
+  Image::Object& sh_obj (*argument[1].get_image (header));
 
-
-  DWI::SH::Coefs res (lmax);
-  Math::Vector sigs (dwis.size());
-
-
-  bool normalise = get_options(2).size();
-
-  ProgressBar::init (dwi.dim(0)*dwi.dim(1)*dwi.dim(2), "converting DW images to SH coefficients...");
-
-  for (dwi.set(2,0), sh.set(2,0); dwi[2] < dwi.dim(2); dwi.inc(2), sh.inc(2)) {
-    for (dwi.set(1,0), sh.set(1,0); dwi[1] < dwi.dim(1); dwi.inc(1), sh.inc(1)) {
-      for (dwi.set(0,0), sh.set(0,0); dwi[0] < dwi.dim(0); dwi.inc(0), sh.inc(0)) {
-
-        double norm = 0.0;
-        if (normalise) {
-          for (guint n = 0; n < bzeros.size(); n++) {
-            dwi.set (3, bzeros[n]);
-            norm += dwi.value ();
-          }
-          norm /= bzeros.size();
-        }
-
-        for (guint n = 0; n < dwis.size(); n++) {
-          dwi.set (3, dwis[n]);
-          sigs[n] = dwi.value(); 
-          if (sigs[n] < 0.0) sigs[n] = 0.0;
-          if (normalise) sigs[n] /= norm;
-        }
-
-        SHT.A2SH (res, sigs);
-
-        for (sh.set(3,0); sh[3] < sh.dim(3); sh.inc(3))
-          sh.value (res.V[sh[3]]);
-
-        ProgressBar::inc();
-      }
-    }
-  }
-
-  ProgressBar::done();
+  Image::SlabProduct fitter (dwi_obj, sh_obj, SHT.mat_A2SH());
+  fitter.set_volumes (dwis);
+  fitter.set_clamp_negative ();
+  if (get_options(2).size()) fitter.set_normalisation (bzeros);
+  fitter.run ("converting DW images to SH coefficients...");
 }
@@ -28,7 +28,7 @@
 */
 
 #include "app.h"
-#include "image/position.h"
+#include "image/slab_product.h"
 #include "math/matrix.h"
 #include "math/linalg.h"
 #include "dwi/gradient.h"
@@ -124,44 +124,32 @@ EXECUTE {
   header.data_type = DataType::Float32;
   header.DW_scheme.reset();
 
-  Image::Position dwi (dwi_obj);
-  Image::Position dt (*argument[1].get_image (header));
+  Image::Object& dt_obj (*argument[1].get_image (header));
 
-  info ("converting base image \"" + dwi.name() + " to tensor image \"" + dt.name() + "\"");
+  info ("converting base image \"" + dwi_obj.name() + " to tensor image \"" + dt_obj.name() + "\"");
 
-  ProgressBar::init (dwi.dim(0)*dwi.dim(1)*dwi.dim(2), "converting DW images to tensor image..."); 
+  grad.copy (bmat);
+  for (guint i = 0; i < ivol.size(); i++)
+    for (int j = 0; j < 7; j++)
+      grad (ivol[i],j) = 0.0;
 
-  std::vector<float> d (dwi.dim(axis));
-  for (dwi.set(2,0), dt.set(2,0); dwi[2] < dwi.dim(2); dwi.inc(2), dt.inc(2)) {
+  pinverter.invert (binv, grad);
 
-    grad.copy (bmat);
-    for (guint i = 0; i < ivol.size(); i++)
-      for (int j = 0; j < 7; j++)
-        grad (ivol[i],j) = 0.0;
+  Image::SlabProduct fitter (dwi_obj, dt_obj, binv, axis);
+  fitter.set_log ();
+  // as before, voxels with non-finite intensities are still fitted:
+  fitter.set_substitute_non_finite ();
 
-    for (guint i = 0; i < islc[dt[2]].size(); i++)
+  for (guint z = 0; z < islc.size(); z++) {
+    if (islc[z].empty()) continue;
+    Math::Matrix slice_grad (grad), slice_binv (binv.rows(), binv.columns());
+    for (guint i = 0; i < islc[z].size(); i++)
       for (int j = 0; j < 7; j++)
-        grad (islc[dt[2]][i],j) = 0.0;
-
-    pinverter.invert (binv, grad);
-
-    for (dwi.set(1,0), dt.set(1,0); dwi[1] < dwi.dim(1); dwi.inc(1), dt.inc(1)) {
-      for (dwi.set(0,0), dt.set(0,0); dwi[0] < dwi.dim(0); dwi.inc(0), dt.inc(0)) {
-        for (dwi.set(axis,0); dwi[axis] < dwi.dim(axis); dwi.inc(axis)) {
-          d[dwi[axis]] = dwi.value();
-          d[dwi[axis]] = d[dwi[axis]] > 0.0 ? -log (d[dwi[axis]]) : 1e-12;
-        }
-        for (dt.set(3,0); dt[3] < dt.dim(3); dt.inc(3)) {
-          float val = 0.0;
-          for (int i = 0; i < dwi.dim(axis); i++)
-            val += (float) (binv(dt[3], i)*d[i]);
-          dt.value (val);
-        }
-        ProgressBar::inc();
-      }
-    }
+        slice_grad (islc[z][i],j) = 0.0;
+    pinverter.invert (slice_binv, slice_grad);
+    fitter.set_slice_transform (z, slice_binv);
   }
 
-  ProgressBar::done();
+  fitter.run ("converting DW images to tensor image...");
 }
 
@@ -21,6 +21,8 @@
 */
 
 #include "app.h"
+#include "ptr.h"
+#include "thread.h"
 #include "image/position.h"
 
 using namespace std; 
@@ -31,6 +33,7 @@ SET_VERSION_DEFAULT;
 
 DESCRIPTION = {
  "erode (or dilate) mask (i.e. binary) image",
+ "Voxels are considered part of the mask if their value is 0.5 or more. Voxels outside the image are treated as being outside the mask. Images with more than 3 dimensions are processed one volume at a time.",
   NULL
 };
 
@@ -48,50 +51,165 @@ OPTIONS = {
   Option ("npass", "number of passes", "the number of passes (default: 1).")
     .append (Argument ("numebr", "number of passes", "the number of passes.").type_integer (1, 1000, 1)),
 
+  Option ("connectivity", "connectivity", "the connectivity of the structuring element, i.e. the number of neighbours of each voxel that are considered: 6 (faces only), 18 (faces and edges) or 26 (faces, edges and corners). The default is 6.")
+    .append (Argument ("number", "number of neighbours", "the number of neighbours.").type_integer (6, 26, 6)),
+
   Option::End 
 
 };
 
 
-float erode (Image::Position& in) 
-{
-  if (in.value() < 0.5) return (0.0);
-  float val;
-  if (in[0] == 0) return (0.0);
-  if (in[1] == 0) return (0.0);
-  if (in[2] == 0) return (0.0);
-  if (in[0] == in.dim(0)-1) return (0.0);
-  if (in[1] == in.dim(1)-1) return (0.0);
-  if (in[2] == in.dim(2)-1) return (0.0);
-  if (in[0] > 0) { in.move(0,-1); val = in.value(); in.inc(0); if (val < 0.5) return (0.0); }
-  if (in[1] > 0) { in.move(1,-1); val = in.value(); in.inc(1); if (val < 0.5) return (0.0); }
-  if (in[2] > 0) { in.move(2,-1); val = in.value(); in.inc(2); if (val < 0.5) return (0.0); }
-  if (in[0] < in.dim(0)-1) { in.inc(0); val = in.value(); in.move(0,-1); if (val < 0.5) return (0.0); }
-  if (in[1] < in.dim(1)-1) { in.inc(1); val = in.value(); in.move(1,-1); if (val < 0.5) return (0.0); }
-  if (in[2] < in.dim(2)-1) { in.inc(2); val = in.value(); in.move(2,-1); if (val < 0.5) return (0.0); }
-  return (1.0);
-}
 
 
+// The mask is held in memory with one bit per voxel, with each row along
+// the x axis packed into consecutive 64-bit words. The neighbours of 64
+// voxels along x can then be combined at once using shifts and bitwise
+// AND (erosion) or OR (dilation) operations, and all passes are performed
+// in memory, with the rows of each pass shared out between threads.
+class Morphology {
+  public:
+    Morphology (Image::Object& input, bool perform_dilation, int connectivity) :
+      in_obj (input), 
+      dilation (perform_dilation), 
+      max_distance (connectivity == 6 ? 1 : ( connectivity == 18 ? 2 : 3 )),
+      nx (input.dim(0)), ny (input.dim(1)), nz (input.dim(2)),
+      nrows (input.voxel_count() / nx),
+      words_per_row ((nx+63)/64),
+      last_word ((nx & 63) ? ( G_GUINT64_CONSTANT(1) << (nx & 63) ) - 1 : ~G_GUINT64_CONSTANT(0)),
+      src (nrows * words_per_row, 0), dest (nrows * words_per_row, 0),
+      loading (false) { }
+
+    void load () 
+    {
+      in_obj.map();
+      loading = true;
+      loop = new Thread::Loop (nrows, MAX (1, 4096/nx));
+      Thread::run (*this);
+      loading = false;
+    }
+
+    void run (int npasses)
+    {
+      ProgressBar::init (npasses * nrows, String (dilation ? "dilat" : "erod") + "ing (" + str(npasses) + " pass" + ( npasses > 1 ? "es" : "" ) + ")...");
+      for (int npass = 0; npass < npasses; npass++) {
+        loop = new Thread::Loop (nrows, MAX (1, 4096/nx));
+        Thread::run (*this);
+        src.swap (dest);
+      }
+      progress.update();
+      ProgressBar::done();
+    }
+
+    void store (Image::Object& output) const
+    {
+      Image::Position out (output);
+      for (gsize row = 0; row < nrows; row++) {
+        set_row (out, row);
+        const guint64* w = &src[row*words_per_row];
+        for (out.set(0,0); out[0] < nx; out.inc(0))
+          out.value ((w[out[0] >> 6] >> (out[0] & 63)) & 1U ? 1.0 : 0.0);
+      }
+    }
+
+    void execute ()
+    {
+      if (loading) load_rows();
+      else filter_rows();
+    }
+
+  protected:
+    Image::Object& in_obj;
+    const bool dilation;
+    const int max_distance, nx, ny, nz;
+    const gsize nrows, words_per_row;
+    const guint64 last_word;
+    std::vector<guint64> src, dest;
+    bool loading;
+    Ptr<Thread::Loop> loop;
+    Thread::Progress progress;
+
+    void set_row (Image::Position& pos, gsize row) const
+    {
+      pos.set (1, row % ny);
+      pos.set (2, (row / ny) % nz);
+      row /= ny*nz;
+      for (int n = 3; n < pos.ndim(); n++) {
+        pos.set (n, row % pos.dim(n));
+        row /= pos.dim(n);
+      }
+    }
+
+    void load_rows ()
+    {
+      Image::Position in (in_obj);
+      gsize first, last;
+      while (loop->next (first, last)) {
+        for (gsize row = first; row < last; row++) {
+          set_row (in, row);
+          guint64* w = &src[row*words_per_row];
+          for (in.set(0,0); in[0] < nx; in.inc(0))
+            if (in.value() >= 0.5) 
+              w[in[0] >> 6] |= G_GUINT64_CONSTANT(1) << (in[0] & 63);
+        }
+      }
+    }
+
+    void filter_rows ()
+    {
+      gsize first, last;
+      while (loop->next (first, last)) {
+        for (gsize row = first; row < last; row++) {
+          const int y = row % ny, z = (row / ny) % nz;
+          guint64* out = &dest[row*words_per_row];
+          const guint64 init = dilation ? 0 : ~G_GUINT64_CONSTANT(0);
+          for (gsize i = 0; i < words_per_row; i++) out[i] = init;
+
+          for (int dz = -1; dz <= 1; dz++) {
+            for (int dy = -1; dy <= 1; dy++) {
+              const int distance = abs (dy) + abs (dz);
+              if (distance > max_distance) continue;
+              if (y+dy < 0 || y+dy >= ny || z+dz < 0 || z+dz >= nz) {
+                // neighbouring row lies outside the image:
+                if (dilation) continue;
+                for (gsize i = 0; i < words_per_row; i++) out[i] = 0;
+                goto row_done;
+              }
+              combine (out, &src[(row + dy + dz*ny) * words_per_row], distance < max_distance);
+            }
+          }
+
+row_done:
+          out[words_per_row-1] &= last_word;
+        }
+        progress.inc (last - first);
+      }
+    }
+
+    // combine the row \a in into \a out, including its neighbours along x if
+    // \a with_x is set. Bit x of word i holds voxel 64*i+x, so that the
+    // neighbour at x-1 is obtained by shifting left, and that at x+1 by
+    // shifting right, carrying bits across words:
+    void combine (guint64* out, const guint64* in, bool with_x) const
+    {
+      for (gsize i = 0; i < words_per_row; i++) {
+        guint64 v = in[i];
+        if (with_x) {
+          const guint64 prev = ( v << 1 ) | ( i > 0 ? in[i-1] >> 63 : 0 );
+          const guint64 next = ( v >> 1 ) | ( i+1 < words_per_row ? in[i+1] << 63 : 0 );
+          v = dilation ? v | prev | next : v & prev & next;
+        }
+        out[i] = dilation ? out[i] | v : out[i] & v;
+      }
+    }
+};
+
 
-float dilate (Image::Position& in) 
-{
-  if (in.value() >= 0.5) return (1.0);
-  float val;
-  if (in[0] > 0) { in.move(0,-1); val = in.value(); in.inc(0); if (val >= 0.5) return (1.0); }
-  if (in[1] > 0) { in.move(1,-1); val = in.value(); in.inc(1); if (val >= 0.5) return (1.0); }
-  if (in[2] > 0) { in.move(2,-1); val = in.value(); in.inc(2); if (val >= 0.5) return (1.0); }
-  if (in[0] < in.dim(0)-1) { in.inc(0); val = in.value(); in.move(0,-1); if (val >= 0.5) return (1.0); }
-  if (in[1] < in.dim(1)-1) { in.inc(1); val = in.value(); in.move(1,-1); if (val >= 0.5) return (1.0); }
-  if (in[2] < in.dim(2)-1) { in.inc(2); val = in.value(); in.move(2,-1); if (val >= 0.5) return (1.0); }
-  return (0.0);
-}
 
 
 EXECUTE {
 
-  RefPtr<Image::Object> obj_in (argument[0].get_image());
-  Image::Header header (obj_in->header());
+  Image::Object& obj_in (*argument[0].get_image());
+  Image::Header header (obj_in.header());
   header.data_type = DataType::Bit;
 
   std::vector<OptBase> opt = get_options (0); // dilate
@@ -100,26 +218,13 @@ EXECUTE {
   opt = get_options (1); // npass
   int npasses = opt.size() ? opt[0][0].get_int() : 1;
 
-  for (int npass = 0; npass < npasses; npass++) {
-    RefPtr<Image::Object> obj_out;
-    if (npass < npasses-1) {
-       obj_out = new Image::Object;
-       obj_out->create ("", header);
-    }
-    else obj_out = argument[1].get_image (header);
-
-    Image::Position in (*obj_in);
-    Image::Position out (*obj_out);
-    ProgressBar::init (out.voxel_count(), (dilation ? "dilat" : "erod" ) + String ("ing (pass ") + str(npass+1) +") ...");
-    do {
-      float val = dilation ? dilate (in) : erode (in);
-      out.value (val);
-      in++;
-      ProgressBar::inc();
-    } while (out++);
-    ProgressBar::done();
-
-    if (npass < npasses-1) obj_in = obj_out;
-  }
-}
+  opt = get_options (2); // connectivity
+  int connectivity = opt.size() ? opt[0][0].get_int() : 6;
+  if (connectivity != 6 && connectivity != 18 && connectivity != 26)
+    throw Exception ("connectivity must be one of 6, 18 or 26");
 
+  Morphology morph (obj_in, dilation, connectivity);
+  morph.load();
+  morph.run (npasses);
+  morph.store (*argument[1].get_image (header));
+}
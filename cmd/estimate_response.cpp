@@ -27,6 +27,8 @@
 #include "dwi/gradient.h"
 #include "dwi/tensor.h"
 #include "dwi/SH.h"
+#include "math/eig3.h"
+#include "math/small_matrix.h"
 
 using namespace std; 
 using namespace MR; 
@@ -128,8 +130,10 @@ EXECUTE {
   Image::Position mask (mask_obj);
 
 
-  Math::Matrix dirs, T, E(3,3), V(3,3), D(3,3), rotated_grad (grad), SHT, iSHT;
-  Math::Vector vec(3), rot(3), sig(dwis.size());
+  Math::Matrix dirs, rotated_grad (grad), SHT, iSHT;
+  Math::Vector sig(dwis.size());
+  Math::SmallMatrix<double,3,3> V;
+  Math::SmallVector<double,3> vec, rot;
   Math::Vector response(lmax/2+1);
   DWI::SH::Coefs SH;
 
@@ -137,7 +141,6 @@ EXECUTE {
   DWI::gen_direction_matrix (dirs, grad, dwis);
   DWI::SH::init_transform (SHT, dirs, lmax);
   Math::PseudoInverter inverter (iSHT, SHT);
-  Math::eig_init (D, true);
 
   int count = 0;
   for (mask.set(2,0); mask[2] < mask.dim(2); mask.inc(2)) 
@@ -170,16 +173,12 @@ EXECUTE {
               dt[n] += (float) (binv(n,i) * val[i]);
           }
 
-	  D(0,0) = dt[0];
-	  D(1,1) = dt[1];
-	  D(2,2) = dt[2];
-	  D(0,1) = D(1,0) = dt[3];
-	  D(0,2) = D(2,0) = dt[4];
-	  D(1,2) = D(2,1) = dt[5];
-
-          double evals[3];
-          Math::eig (D, evals, V);
-	  V.transpose();
+          // V holds the eigenvectors as its rows:
+          double evals[3], evec[3][3];
+          Math::eig3 (dt, evals, evec);
+          for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++)
+              V(i,j) = evec[j][i];
 
 	  for (guint i = 0; i < grad.rows(); i++) {
 	    vec[0] = grad(i,0);
@@ -223,7 +222,6 @@ EXECUTE {
     }
   }
   ProgressBar::done();
-  Math::eig_end ();
 
   std::ofstream response_file (argument[2].get_string());
 
@@ -25,6 +25,7 @@
 */
 
 #include "app.h"
+#include "thread.h"
 #include "image/position.h"
 #include "dwi/SH.h"
 
@@ -37,6 +38,7 @@ SET_VERSION_DEFAULT;
 
 DESCRIPTION = {
   "identify the orientations of the N largest peaks of a SH profile",
+  "At each voxel, the amplitude of the SH profile is first evaluated along each of the directions supplied. The search for each peak is then started from those directions whose amplitude is larger than that of all their neighbours within the set, and the results are refined to the nearest true peak of the profile.",
   NULL
 };
 
@@ -76,13 +78,212 @@ class Direction {
     bool operator<(const Direction& d) const { return (a > d.a); }
 };
 
+
+
+
+
+// Rather than starting a search from every direction in the set, the
+// amplitudes along all directions are computed with a single matrix-vector
+// product, and searches are started only from the local maxima of these
+// amplitudes over the direction set. Rows of voxels are shared out between
+// threads.
+class PeakFinder {
+  public:
+    PeakFinder (Image::Object& SH_image, Image::Object& output, Image::Object* peaks_image, const Math::Matrix& directions, 
+        int num_peaks, const std::vector<Direction>& true_peak_directions, float amplitude_threshold) :
+      SH_obj (SH_image), out_obj (output), peaks_obj (peaks_image), 
+      npeaks (num_peaks), true_peaks (true_peak_directions), threshold (amplitude_threshold),
+      lmax (DWI::SH::LforN (SH_image.dim(3))),
+      loop (SH_image.dim(1) * SH_image.dim(2))
+    {
+      DWI::SH::init_transform (SHT, directions, lmax);
+
+      for (guint i = 0; i < directions.rows(); i++) 
+        dirs.push_back (Direction (directions(i,0), directions(i,1)));
+
+      // the neighbours of each direction are those within 1.5 times the
+      // largest distance between any direction and its nearest neighbour.
+      // Since the SH profile is antipodally symmetric, so is the distance:
+      float min_dot = 1.0;
+      for (guint i = 0; i < dirs.size(); i++) {
+        float nearest = 0.0;
+        for (guint j = 0; j < dirs.size(); j++) {
+          float f = fabs (dirs[i].v.dot (dirs[j].v));
+          if (j != i && f > nearest) nearest = f;
+        }
+        if (nearest < min_dot) min_dot = nearest;
+      }
+      const float neighbour_dot = cos (1.5 * acos (MIN (min_dot, 1.0)));
+
+      neighbours.resize (dirs.size());
+      for (guint i = 0; i < dirs.size(); i++) 
+        for (guint j = 0; j < dirs.size(); j++) 
+          if (j != i && fabs (dirs[i].v.dot (dirs[j].v)) >= neighbour_dot) 
+            neighbours[i].push_back (j);
+    }
+
+    void run ()
+    {
+      SH_obj.map();
+      out_obj.map();
+      if (peaks_obj) peaks_obj->map();
+
+      info ("using lmax = " + str (lmax));
+      ProgressBar::init (loop.size(), "finding orientations of largest peaks...");
+      Thread::run (*this);
+      progress.update();
+      ProgressBar::done();
+    }
+
+    void execute ()
+    {
+      Image::Position SH (SH_obj);
+      Image::Position out (out_obj);
+      Ptr<Image::Position> ipeaks;
+      if (peaks_obj) ipeaks = new Image::Position (*peaks_obj);
+
+      std::vector<float> val (SH.dim(3));
+      Math::Vector coefs (SHT.columns()), amplitudes (SHT.rows());
+      std::vector<Direction> all_peaks, peaks_out (npeaks);
+      gsize first, last;
+
+      while (loop.next (first, last)) {
+        for (gsize row = first; row < last; row++) {
+          SH.set (1, row % SH.dim(1)); SH.set (2, row / SH.dim(1));
+          out.set (1, SH[1]); out.set (2, SH[2]);
+          if (ipeaks) { ipeaks->set (1, SH[1]); ipeaks->set (2, SH[2]); }
+
+          for (SH.set(0,0), out.set(0,0); SH[0] < SH.dim(0); SH.inc(0), out.inc(0)) {
+
+            bool skip = false;
+            if (ipeaks) {
+              ipeaks->set(0, SH[0]);
+              if (gsl_isnan (ipeaks->value())) skip = true;
+            }
+
+            if (!skip) {
+              float min = GSL_POSINF, max = GSL_NEGINF;
+              for (SH.set(3,0); SH[3] < SH.dim(3); SH.inc(3)) {
+                val[SH[3]] = SH.value();
+                if (gsl_isnan (val[SH[3]])) {
+                  skip = true;
+                  break;
+                }
+                if (val[SH[3]] < min) min = val[SH[3]];
+                if (val[SH[3]] > max) max = val[SH[3]];
+              }
+              if (min == max) skip = true;
+            }
+
+            if (skip) {
+              for (out.set(3,0); out[3] < out.dim(3); out.inc(3)) out.value (GSL_NAN);
+              continue;
+            }
+
+            find_peaks (val, coefs, amplitudes, all_peaks);
+            
+            if (ipeaks) {
+              for (int i = 0; i < npeaks; i++) {
+                Point p;
+                ipeaks->set(3, 3*i);
+                for (int n = 0; n < 3; n++) { p[n] = ipeaks->value(); ipeaks->inc(3); }
+                p.normalise();
+
+                float mdot = 0.0;
+                for (guint n = 0; n < all_peaks.size(); n++) {
+                  float f = fabs (p.dot (all_peaks[n].v));
+                  if (f > mdot) { 
+                    mdot = f; 
+                    peaks_out[i] = all_peaks[n];
+                  }
+                }
+              }
+            }
+            else if (true_peaks.size()) {
+              for (int i = 0; i < npeaks; i++) {
+                float mdot = 0.0;
+                for (guint n = 0; n < all_peaks.size(); n++) {
+                  float f = fabs (all_peaks[n].v.dot (true_peaks[i].v));
+                  if (f > mdot) { 
+                    mdot = f; 
+                    peaks_out[i] = all_peaks[n];
+                  }
+                }
+              }
+            }
+            else std::partial_sort_copy (all_peaks.begin(), all_peaks.end(), peaks_out.begin(), peaks_out.end());
+
+            int actual_npeaks = MIN (npeaks, (int) all_peaks.size());
+            out.set (3, 0);
+            for (int n = 0; n < actual_npeaks; n++) {
+              out.value (peaks_out[n].a*peaks_out[n].v[0]); out.inc(3); 
+              out.value (peaks_out[n].a*peaks_out[n].v[1]); out.inc(3); 
+              out.value (peaks_out[n].a*peaks_out[n].v[2]); out.inc(3);
+            }
+            for (; out[3] < 3*npeaks; out.inc(3)) out.value (GSL_NAN);
+          }
+        }
+        progress.inc (last - first);
+      }
+    }
+
+  protected:
+    Image::Object& SH_obj;
+    Image::Object& out_obj;
+    Image::Object* peaks_obj;
+    const int npeaks;
+    const std::vector<Direction>& true_peaks;
+    const float threshold;
+    const int lmax;
+    Math::Matrix SHT;
+    std::vector<Direction> dirs;
+    std::vector<std::vector<guint> > neighbours;
+    Thread::Loop loop;
+    Thread::Progress progress;
+
+    void find_peaks (const std::vector<float>& val, Math::Vector& coefs, Math::Vector& amplitudes, std::vector<Direction>& all_peaks) const
+    {
+      for (guint n = 0; n < coefs.size(); n++) coefs[n] = val[n];
+      amplitudes.multiply (SHT, coefs);
+
+      all_peaks.clear();
+      for (guint i = 0; i < dirs.size(); i++) {
+        // only search from the local maxima of the amplitudes, breaking
+        // ties in favour of the first direction:
+        bool is_max = true;
+        for (guint n = 0; n < neighbours[i].size(); n++) {
+          guint j = neighbours[i][n];
+          if (amplitudes[j] > amplitudes[i] || ( amplitudes[j] == amplitudes[i] && j < i )) { is_max = false; break; }
+        }
+        if (!is_max) continue;
+
+        Direction p (dirs[i]);
+        p.a = DWI::SH::get_peak (&val[0], lmax, p.v, true);
+
+        if (gsl_finite (p.a)) {
+          for (guint j = 0; j < all_peaks.size(); j++) {
+            if (fabs (p.v.dot (all_peaks[j].v)) > DOT_THRESHOLD) {
+              p.a = GSL_NAN;
+              break;
+            }
+          }
+        }
+        if (gsl_finite (p.a) && p.a >= threshold) all_peaks.push_back (p);
+      }
+    }
+};
+
+
+
+
+
 EXECUTE {
 
   // Load direction set:
   Math::Matrix dirs;
   dirs.load (argument[1].get_string());
   if (dirs.columns() != 2) 
-    throw ("expecting 2 columns for search directions matrix");
+    throw Exception ("expecting 2 columns for search directions matrix");
   
   std::vector<OptBase> opt = get_options (0); // num
   int npeaks = opt.size() ? opt[0][0].get_int() : 3;
@@ -105,125 +306,22 @@ EXECUTE {
   header.data_type = DataType::Float32;
   header.axes.set_ndim (4);
 
-  Ptr<Image::Position> ipeaks;
+  Image::Object* peaks_obj = NULL;
   opt = get_options (2); // peaks image
   if (opt.size()) {
     if (true_peaks.size()) throw Exception ("you can't specify both a peaks file and orientations to be estimated at the same time");
-    ipeaks = new Image::Position (*opt[0][0].get_image());
-    if (ipeaks->dim(0) != header.dim(0) || ipeaks->dim(1) != header.dim(1) || ipeaks->dim(2) != header.dim(2))
-      throw Exception ("dimensions of peaks image \"" + ipeaks->name() + "\" do not match that of SH coefficients image \"" + SH_obj.name() + "\"");
-    npeaks = ipeaks->dim(3) / 3;
+    peaks_obj = opt[0][0].get_image().get();
+    if (peaks_obj->dim(0) != header.dim(0) || peaks_obj->dim(1) != header.dim(1) || peaks_obj->dim(2) != header.dim(2))
+      throw Exception ("dimensions of peaks image \"" + peaks_obj->name() + "\" do not match that of SH coefficients image \"" + SH_obj.name() + "\"");
+    npeaks = peaks_obj->dim(3) / 3;
   }
 
   header.axes.dim[3] = 3 * npeaks;
 
-  Image::Position SH (SH_obj);
-  Image::Position out (*argument[2].get_image (header));
-
-  std::vector<Direction> peaks_out (npeaks);
-  std::vector<float> val (SH.dim(3));
-  int lmax = DWI::SH::LforN (SH.dim(3));
-  DWI::SH::precompute (lmax, 512);
-  
- 
-  info ("using lmax = " + str (lmax));
-
-  ProgressBar::init (SH.dim(0)*SH.dim(1)*SH.dim(2), "finding orientations of largest peaks...");
-
-  for (SH.set(2,0), out.set(2,0); SH[2] < SH.dim(2); SH.inc(2), out.inc(2)) {
-    if (ipeaks.get()) ipeaks->set(2,SH[2]);
-
-    for (SH.set(1,0), out.set(1,0); SH[1] < SH.dim(1); SH.inc(1), out.inc(1)) {
-      if (ipeaks.get()) ipeaks->set(1,SH[1]);
-
-      for (SH.set(0,0), out.set(0,0); SH[0] < SH.dim(0); SH.inc(0), out.inc(0)) {
-
-        bool skip = false;
-        if (ipeaks.get()) {
-          ipeaks->set(0, SH[0]);
-          if (gsl_isnan (ipeaks->value())) skip = true;
-        }
-        
-        if (!skip) {
-          float min = GSL_POSINF, max = GSL_NEGINF;
-          for (SH.set(3,0); SH[3] < SH.dim(3); SH.inc(3)) {
-            val[SH[3]] = SH.value();
-            if (gsl_isnan (val[SH[3]])) {
-              skip = true;
-              break;
-            }
-            if (val[SH[3]] < min) min = val[SH[3]];
-            if (val[SH[3]] > max) max = val[SH[3]];
-          }
-          if (min == max) skip = true;
-        }
-
-        if (skip) for (out.set(3,0); out[3] < out.dim(3); out.inc(3)) out.value (GSL_NAN);
-        else {
-          std::vector<Direction> all_peaks;
-          for (guint i = 0; i < dirs.rows(); i++) {
-            Direction p (dirs(i,0), dirs(i,1)); 
-            p.a = DWI::SH::get_peak (&val[0], lmax, p.v, true);
-            
-            if (gsl_finite (p.a)) {
-              for (guint j = 0; j < all_peaks.size(); j++) {
-                if (fabs (p.v.dot (all_peaks[j].v)) > DOT_THRESHOLD) {
-                  p.a = GSL_NAN;
-                  break;
-                }
-              }
-            }
-            if (gsl_finite (p.a) && p.a >= threshold) all_peaks.push_back (p);
-          }
-          
-          if (ipeaks.get()) {
-            for (int i = 0; i < npeaks; i++) {
-              Point p;
-              ipeaks->set(3, 3*i);
-              for (int n = 0; n < 3; n++) { p[n] = ipeaks->value(); ipeaks->inc(3); }
-              p.normalise();
-
-              float mdot = 0.0;
-              for (guint n = 0; n < all_peaks.size(); n++) {
-                float f = fabs (p.dot (all_peaks[n].v));
-                if (f > mdot) { 
-                  mdot = f; 
-                  peaks_out[i] = all_peaks[n];
-                }
-              }
-            }
-          }
-          else if (true_peaks.size()) {
-            for (int i = 0; i < npeaks; i++) {
-              float mdot = 0.0;
-              for (guint n = 0; n < all_peaks.size(); n++) {
-                float f = fabs (all_peaks[n].v.dot (true_peaks[i].v));
-                if (f > mdot) { 
-                  mdot = f; 
-                  peaks_out[i] = all_peaks[n];
-                }
-              }
-            }
-          }
-          else std::partial_sort_copy (all_peaks.begin(), all_peaks.end(), peaks_out.begin(), peaks_out.end());
-
+  Image::Object& out_obj (*argument[2].get_image (header));
 
+  DWI::SH::precompute (DWI::SH::LforN (SH_obj.dim(3)), 512);
 
-          
-          int actual_npeaks = MIN (npeaks, (int) all_peaks.size());
-          out.set (3, 0);
-          for (int n = 0; n < actual_npeaks; n++) {
-             out.value (peaks_out[n].a*peaks_out[n].v[0]); out.inc(3); 
-             out.value (peaks_out[n].a*peaks_out[n].v[1]); out.inc(3); 
-             out.value (peaks_out[n].a*peaks_out[n].v[2]); out.inc(3);
-          }
-          for (; out[3] < 3*npeaks; out.inc(3)) out.value (GSL_NAN);
-        }
-
-        ProgressBar::inc();
-      }
-    }
-  }
-  ProgressBar::done();
+  PeakFinder finder (SH_obj, out_obj, peaks_obj, dirs, npeaks, true_peaks, threshold);
+  finder.run();
 }
-
@@ -41,7 +41,7 @@ ARGUMENTS = {
 };
 
 
-const gchar* data_type_choices[] = { "FLOAT32", "FLOAT32LE", "FLOAT32BE", "FLOAT64", "FLOAT64LE", "FLOAT64BE", 
+const gchar* data_type_choices[] = { "FLOAT32", "FLOAT32LE", "FLOAT32BE", "FLOAT64", "FLOAT64LE", "FLOAT64BE", "FLOAT16", "FLOAT16LE", "FLOAT16BE", 
     "INT32", "UINT32", "INT32LE", "UINT32LE", "INT32BE", "UINT32BE", 
     "INT16", "UINT16", "INT16LE", "UINT16LE", "INT16BE", "UINT16BE", 
     "CFLOAT32", "CFLOAT32LE", "CFLOAT32BE", "CFLOAT64", "CFLOAT64LE", "CFLOAT64BE", 
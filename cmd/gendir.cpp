@@ -23,6 +23,8 @@
 #include <gsl/gsl_multimin.h>
 
 #include "app.h"
+#include "ptr.h"
+#include "thread.h"
 #include "math/vector.h"
 #include "math/simulation.h"
 
@@ -33,6 +35,7 @@ SET_VERSION_DEFAULT;
 
 DESCRIPTION = {
   "generate a set of directions evenly distributed over a hemisphere.",
+  "The directions are found by minimising the electrostatic repulsion energy of the set, using a conjugate gradient optimisation, with the exponent of the repulsion power law doubled in turn up to the value specified. Since the optimisation may converge to a local minimum, it can be restarted several times from different random initial directions, keeping the best result. For large numbers of directions, interactions between directions further apart than the cutoff angle can be ignored, which greatly reduces the computation time.",
   NULL
 };
 
@@ -49,66 +52,268 @@ OPTIONS = {
   Option ("niter", "max number of iterations", "specify the maximum number of iterations to perform.")
     .append (Argument ("num", "number", "maximum number of iterations to perform").type_integer (1, 1000000, 10000)),
 
+  Option ("restarts", "number of restarts", "perform the optimisation from this many different random initial directions, and keep the set with the lowest energy. The restarts are run concurrently (default: 1).")
+    .append (Argument ("num", "number", "the number of restarts").type_integer (1, 10000, 1)),
+
+  Option ("cutoff", "interaction cutoff", "ignore the interactions between directions more than this angle apart (in degrees). This provides an approximation to the energy whose computation scales linearly with the number of directions, rather than quadratically. Given the high exponents used, values of 30 degrees or more are typically sufficient (default: 0, i.e. compute all interactions).")
+    .append (Argument ("angle", "angle", "the cutoff angle").type_float (0.0, 60.0, 0.0)),
+
   Option::End 
 };
 
 
 
 
+// the largest number of cells along each axis of the spatial hash:
+#define MAX_HASH_CELLS 64
 
+// the number of directions per thread below which starting the threads for
+// each evaluation of the energy costs more than it saves:
+#define MIN_DIRS_PER_THREAD 256
 
-namespace {
-  double power = -1.0;
-  guint   ndirs = 0;
-}
 
 
 
+// The energy of the direction set, and its gradient with respect to the
+// parameters being optimised. Direction 0 is fixed along z, and direction 1
+// has zero azimuth, leaving 2N-3 parameters: the elevation of direction 1,
+// followed by the azimuth & elevation of each subsequent direction.
+//
+// The pairwise interactions are computed from the unit vectors of the
+// directions, held as separate arrays of x, y & z components so that the
+// inner loops can be vectorised, and the rows of pairs are shared out between
+// threads, provided there are enough directions for this to pay off. If a
+// cutoff angle is set, the directions (and their opposites) are first binned
+// into a uniform grid of cells of at least that size, and only the pairs
+// found in neighbouring cells are considered.
+class Energy {
+  public:
+    Energy (guint num_directions, float cutoff_angle, guint num_threads) :
+      ndirs (num_directions), nthreads (MIN (num_threads, MAX (1U, num_directions / MIN_DIRS_PER_THREAD))), exponent (1), 
+      cos_cutoff (cutoff_angle > 0.0 ? cos (cutoff_angle) : -1.0),
+      ncells (0),
+      x (ndirs), y (ndirs), z (ndirs), cos_az (ndirs), sin_az (ndirs), cos_el (ndirs), sin_el (ndirs),
+      gx (ndirs), gy (ndirs), gz (ndirs)
+    {
+      if (cutoff_angle > 0.0) {
+        ncells = MAX (1, MIN (MAX_HASH_CELLS, int (1.0 / sin (cutoff_angle/2.0))));
+        cell_start.resize (ncells*ncells*ncells + 1);
+        entries.resize (2*ndirs);
+        entry_cell.resize (2*ndirs);
+      }
+    }
+
+    //! use a repulsion law of 1/r^(2*half_exponent)
+    void set_exponent (int half_exponent) { exponent = half_exponent; }
+
+    double compute (const gsl_vector* v, gsl_vector* df)
+    {
+      for (guint i = 0; i < ndirs; i++) {
+        double az = i > 1 ? gsl_vector_get (v, 2*i-3) : 0.0;
+        double el = i ? gsl_vector_get (v, 2*i-2) : 0.0;
+        cos_az[i] = cos (az); sin_az[i] = sin (az);
+        cos_el[i] = cos (el); sin_el[i] = sin (el);
+        x[i] = cos_az[i]*sin_el[i];
+        y[i] = sin_az[i]*sin_el[i];
+        z[i] = cos_el[i];
+      }
+
+      if (ncells) build_hash();
+
+      with_gradient = df;
+      E = 0.0;
+      if (df) {
+        for (guint i = 0; i < ndirs; i++) gx[i] = gy[i] = gz[i] = 0.0;
+      }
+
+      loop = new Thread::Loop (ndirs, MAX (1, ndirs / (16*nthreads)));
+      Thread::run (*this, nthreads);
+
+      // convert the gradient with respect to the unit vectors into that
+      // with respect to the azimuth & elevation:
+      if (df) {
+        for (guint i = 1; i < ndirs; i++) {
+          gsl_vector_set (df, 2*i-2, gx[i]*cos_az[i]*cos_el[i] + gy[i]*sin_az[i]*cos_el[i] - gz[i]*sin_el[i]);
+          if (i > 1) 
+            gsl_vector_set (df, 2*i-3, (gy[i]*cos_az[i] - gx[i]*sin_az[i]) * sin_el[i]);
+        }
+      }
+
+      return (E);
+    }
+
+    void execute ()
+    {
+      double energy = 0.0;
+      std::vector<double> tx, ty, tz;
+      if (with_gradient) {
+        tx.assign (ndirs, 0.0); ty.assign (ndirs, 0.0); tz.assign (ndirs, 0.0);
+      }
+      gsize first, last;
+
+      while (loop->next (first, last)) {
+        for (gsize i = first; i < last; i++) {
+          if (ncells) energy += hashed_row (i, tx, ty, tz);
+          else energy += full_row (i, tx, ty, tz);
+        }
+      }
+
+      Glib::Mutex::Lock lock (mutex);
+      E += energy;
+      if (with_gradient) {
+        for (guint i = 0; i < ndirs; i++) {
+          gx[i] += tx[i]; gy[i] += ty[i]; gz[i] += tz[i];
+        }
+      }
+    }
 
-class SinCos {
   protected:
-    double cos_az, sin_az, cos_el, sin_el;
-    double r2_pos, r2_neg, multiplier;
+    const guint ndirs, nthreads;
+    int exponent;
+    const double cos_cutoff;
+    int ncells;
+    std::vector<double> x, y, z, cos_az, sin_az, cos_el, sin_el, gx, gy, gz;
+    std::vector<guint> cell_start, entries, entry_cell;
+
+    bool with_gradient;
+    double E;
+    Ptr<Thread::Loop> loop;
+    Glib::Mutex mutex;
+
+    static inline double ipow (double value, int n)
+    {
+      double r = 1.0;
+      for (; n; n >>= 1) {
+        if (n & 1) r *= value;
+        value *= value;
+      }
+      return (r);
+    }
 
-    double energy ();
-    void   dist (const SinCos& B);
-    void   init_deriv ();
-    double daz (const SinCos& B) const;
-    double del (const SinCos& B) const;
-    double rdel (const SinCos& B) const;
+    // the energy of the pair with dot product d is 2 / r+^(2n) + 2 / r-^(2n),
+    // where r+ and r- are the distances to the direction and to its
+    // opposite. Returns the energy, and sets coef to its derivative with
+    // respect to d:
+    inline double pair (double d, double& coef) const
+    {
+      const double ipos = 1.0 / (2.0 + 2.0*d), ineg = 1.0 / (2.0 - 2.0*d);
+      const double pos = ipow (ipos, exponent), neg = ipow (ineg, exponent);
+      coef = 4.0 * exponent * (neg*ineg - pos*ipos);
+      return (2.0 * (pos + neg));
+    }
 
-  public:
-    SinCos (const gsl_vector* v, guint index);
-    double f (const SinCos& B);
-    void   df (const SinCos& B, gsl_vector* deriv, guint i, guint j);
-    double fdf (const SinCos& B, gsl_vector* deriv, guint i, guint j);
+    double full_row (guint i, std::vector<double>& tx, std::vector<double>& ty, std::vector<double>& tz) const
+    {
+      double energy = 0.0, coef, Gx = 0.0, Gy = 0.0, Gz = 0.0;
+      for (guint j = i+1; j < ndirs; j++) {
+        energy += pair (x[i]*x[j] + y[i]*y[j] + z[i]*z[j], coef);
+        if (with_gradient) {
+          Gx += coef*x[j]; Gy += coef*y[j]; Gz += coef*z[j];
+          tx[j] += coef*x[i]; ty[j] += coef*y[i]; tz[j] += coef*z[i];
+        }
+      }
+      if (with_gradient) { tx[i] += Gx; ty[i] += Gy; tz[i] += Gz; }
+      return (energy);
+    }
+
+    double hashed_row (guint i, std::vector<double>& tx, std::vector<double>& ty, std::vector<double>& tz) const
+    {
+      double energy = 0.0, coef, Gx = 0.0, Gy = 0.0, Gz = 0.0;
+      const int cx = cell (x[i]), cy = cell (y[i]), cz = cell (z[i]);
+
+      for (int kz = MAX (cz-1, 0); kz <= MIN (cz+1, ncells-1); kz++) {
+        for (int ky = MAX (cy-1, 0); ky <= MIN (cy+1, ncells-1); ky++) {
+          for (int kx = MAX (cx-1, 0); kx <= MIN (cx+1, ncells-1); kx++) {
+            const guint c = kx + ncells*(ky + ncells*kz);
+            for (guint e = cell_start[c]; e < cell_start[c+1]; e++) {
+              // entries hold the direction index, times 2 plus 1 for the
+              // opposite direction:
+              const guint j = entries[e] >> 1;
+              if (j <= i) continue;
+              const double d = x[i]*x[j] + y[i]*y[j] + z[i]*z[j];
+              // consider each pair only once, via the entry on the same side:
+              if ((d < 0.0) != bool (entries[e] & 1U) || fabs (d) < cos_cutoff) continue;
+
+              energy += pair (d, coef);
+              if (with_gradient) {
+                Gx += coef*x[j]; Gy += coef*y[j]; Gz += coef*z[j];
+                tx[j] += coef*x[i]; ty[j] += coef*y[i]; tz[j] += coef*z[i];
+              }
+            }
+          }
+        }
+      }
+
+      if (with_gradient) { tx[i] += Gx; ty[i] += Gy; tz[i] += Gz; }
+      return (energy);
+    }
+
+    int cell (double coord) const 
+    { 
+      int c = int (0.5 * (coord + 1.0) * ncells);
+      return (c < 0 ? 0 : ( c >= ncells ? ncells-1 : c ));
+    }
+
+    // sort each direction and its opposite into the grid of cells:
+    void build_hash ()
+    {
+      std::fill (cell_start.begin(), cell_start.end(), 0);
+      for (guint n = 0; n < 2*ndirs; n++) {
+        const double s = n & 1U ? -1.0 : 1.0;
+        const guint i = n >> 1;
+        entry_cell[n] = cell (s*x[i]) + ncells*(cell (s*y[i]) + ncells*cell (s*z[i]));
+        cell_start[entry_cell[n]+1]++;
+      }
+      for (guint c = 1; c < cell_start.size(); c++) cell_start[c] += cell_start[c-1];
+
+      std::vector<guint> pos (cell_start.begin(), cell_start.end()-1);
+      for (guint n = 0; n < 2*ndirs; n++) 
+        entries[pos[entry_cell[n]]++] = n;
+    }
 };
 
 
 
-double energy_f   (const gsl_vector *x, void *params);
-void   energy_df  (const gsl_vector *x, void *params, gsl_vector *df);
-void   energy_fdf (const gsl_vector *x, void *params, double *f, gsl_vector *df);
+double energy_f (const gsl_vector *x, void *params)
+{
+  return (((Energy*) params)->compute (x, NULL));
+}
 
+void energy_df (const gsl_vector *x, void *params, gsl_vector *df)
+{
+  ((Energy*) params)->compute (x, df);
+}
 
-void range (double& azimuth, double& elevation);
+void energy_fdf (const gsl_vector *x, void *params, double *f, gsl_vector *df)
+{
+  *f = ((Energy*) params)->compute (x, df);
+}
 
 
-EXECUTE {
-  guint niter = 10000;
-  float target_power = 128.0;
 
-  std::vector<OptBase> opt = get_options (0); // power
-  if (opt.size()) target_power = opt[0][0].get_int();
+inline void range (double& azimuth, double& elevation)
+{
+  while (elevation < 0.0) elevation += 2.0*M_PI;
+  while (elevation >= 2.0*M_PI) elevation -= 2.0*M_PI;
+  if (elevation >= M_PI) {
+    elevation = 2.0*M_PI - elevation;
+    azimuth -= M_PI;
+  }
+  while (azimuth < -M_PI) azimuth += 2.0*M_PI;
+  while (azimuth >= M_PI) azimuth -= 2.0*M_PI;
+}
+
 
-  opt = get_options (1); // niter
-  if (opt.size()) niter = opt[0][0].get_int();
 
-  ndirs = argument[0].get_int();
 
 
-  Math::RNG    rng;
-  Math::Vector v (2*ndirs-3);
+// run the optimisation from random initial directions, doubling the
+// exponent of the power law in turn up to the target. Returns the final
+// energy, and the optimised parameters in v:
+double optimise (guint ndirs, float target_power, guint niter, float cutoff, guint seed, guint nthreads, bool verbose, Math::Vector& v, Thread::Progress& progress)
+{
+  Math::RNG rng (seed);
+  v.allocate (2*ndirs-3);
 
   v[0] = asin (2.0 * rng.uniform() - 1.0);
   for (guint n = 1; n < 2*ndirs-3; n+=2) {
@@ -116,186 +321,148 @@ EXECUTE {
     v[n+1] = asin (2.0 * rng.uniform() - 1.0);
   }
 
+  Energy energy (ndirs, cutoff, nthreads);
+
   gsl_multimin_function_fdf fdf;
 
   fdf.f = energy_f;
   fdf.df = energy_df;
   fdf.fdf = &energy_fdf;
   fdf.n = 2*ndirs-3;
+  fdf.params = &energy;
 
   gsl_multimin_fdfminimizer *minimizer =
       gsl_multimin_fdfminimizer_alloc (gsl_multimin_fdfminimizer_conjugate_fr, 2*ndirs-3);
 
-
-  ProgressBar::init (0, "Optimising directions");
-  for (power = -1.0; power >= -target_power/2.0; power *= 2.0) {
-    info ("setting power = " + str (-power*2.0));
+  for (int power = 1; power <= target_power/2.0; power *= 2) {
+    if (verbose) info ("setting power = " + str (power*2));
+    energy.set_exponent (power);
     gsl_multimin_fdfminimizer_set (minimizer, &fdf, v.get_gsl_vector(), 0.01, 1e-4);
 
     for (guint iter = 0; iter < niter; iter++) {
 
       int status = gsl_multimin_fdfminimizer_iterate (minimizer);
 
-      if (iter%10 == 0) 
-        info ("[ " + str(iter) + " ] (pow = " + str(-power*2.0) + ") E = " + str(minimizer->f) + ", grad = " + str(gsl_blas_dnrm2 (minimizer->gradient)));
+      if (verbose && iter%10 == 0) 
+        info ("[ " + str(iter) + " ] (pow = " + str(power*2) + ") E = " + str(minimizer->f) + ", grad = " + str(gsl_blas_dnrm2 (minimizer->gradient)));
 
       if (status) {
-        info (String("iteration stopped: ") + gsl_strerror (status));
+        if (verbose) info (String("iteration stopped: ") + gsl_strerror (status));
         break;
       }
 
-      ProgressBar::inc();
+      progress.inc();
     }
     v.copy (minimizer->x);
   }
-  ProgressBar::done();
-
-
-
-  Math::Matrix directions (ndirs, 2);
-  directions(0,0) = 0.0;
-  directions(0,1) = 0.0;
-  directions(1,0) = 0.0;
-  directions(1,1) = gsl_vector_get (minimizer->x, 0);
-  for (guint n = 2; n < ndirs; n++) {
-    double az = gsl_vector_get (minimizer->x, 2*n-3);
-    double el = gsl_vector_get (minimizer->x, 2*n-2);
-    range(az, el);
-    directions (n, 0) = az;
-    directions (n, 1) = el;
-  }
 
+  double E = minimizer->f;
   gsl_multimin_fdfminimizer_free (minimizer);
-
-  directions.save (argument[1].get_string());
+  return (E);
 }
 
 
 
 
+// runs independent optimisations concurrently, keeping the best:
+class MultiStart {
+  public:
+    MultiStart (guint num_directions, float target_power, guint num_iterations, float cutoff_angle, const std::vector<guint>& random_seeds) :
+      ndirs (num_directions), power (target_power), niter (num_iterations), cutoff (cutoff_angle), seeds (random_seeds),
+      best_energy (GSL_POSINF), loop (seeds.size()), messages (NULL) { }
+
+    void execute ()
+    {
+      gsize first, last;
+      Math::Vector v;
+      while (loop.next (first, last)) {
+        for (gsize n = first; n < last; n++) {
+          messages->item (n);
+          double E = optimise (ndirs, power, niter, cutoff, seeds[n], 1, false, v, progress);
+          Glib::Mutex::Lock lock (mutex);
+          info ("restart " + str(n+1) + ": final energy = " + str(E));
+          if (E < best_energy) {
+            best_energy = E;
+            best.copy (v);
+          }
+        }
+      }
+    }
 
+    const guint ndirs;
+    const float power;
+    const guint niter;
+    const float cutoff;
+    const std::vector<guint>& seeds;
+
+    double best_energy;
+    Math::Vector best;
+    Thread::Loop loop;
+    Thread::Progress progress;
+    Thread::Messages* messages;
+    Glib::Mutex mutex;
+};
 
 
 
 
+EXECUTE {
+  guint niter = 10000;
+  float target_power = 128.0;
 
+  std::vector<OptBase> opt = get_options (0); // power
+  if (opt.size()) target_power = opt[0][0].get_int();
 
-inline double SinCos::energy () { return (pow (r2_pos, power) + pow (r2_neg, power)); }
-
-inline void SinCos::dist (const SinCos& B)
-{
-  double a1 = cos_az*sin_el;
-  double b1 = B.cos_az*B.sin_el;
-  double a2 = sin_az*sin_el;
-  double b2 = B.sin_az*B.sin_el;
-  r2_pos = (a1+b1)*(a1+b1) + (a2+b2)*(a2+b2) + (cos_el+B.cos_el)*(cos_el+B.cos_el);
-  r2_neg = (a1-b1)*(a1-b1) + (a2-b2)*(a2-b2) + (cos_el-B.cos_el)*(cos_el-B.cos_el);
-}
-
-inline void SinCos::init_deriv () { multiplier = 2.0 * power * (pow (r2_neg, power-1.0) - pow (r2_pos, power-1.0)); }
-
-inline double SinCos::daz (const SinCos& B) const 
-{
-  return (multiplier * (cos_az*sin_el*B.sin_az*B.sin_el - sin_az*sin_el*B.cos_az*B.sin_el)); 
-}
-
-inline double SinCos::del (const SinCos& B) const 
-{ 
-  return (multiplier * (cos_az*cos_el*B.cos_az*B.sin_el + sin_az*cos_el*B.sin_az*B.sin_el - sin_el*B.cos_el)); 
-}
-
-inline double SinCos::rdel (const SinCos& B) const 
-{ 
-  return (multiplier * (B.cos_az*B.cos_el*cos_az*sin_el + B.sin_az*B.cos_el*sin_az*sin_el - B.sin_el*cos_el)); 
-}
-
-inline SinCos::SinCos (const gsl_vector* v, guint index) 
-{
-  double az = index > 1 ? gsl_vector_get (v, 2*index-3) : 0.0;
-  double el = index ? gsl_vector_get (v, 2*index-2) : 0.0;
-  cos_az = cos (az); sin_az = sin (az);
-  cos_el = cos (el); sin_el = sin (el);
-}
-
-inline double SinCos::f (const SinCos& B) 
-{
-  dist (B);
-  return (energy()); 
-}
+  opt = get_options (1); // niter
+  if (opt.size()) niter = opt[0][0].get_int();
 
-inline void SinCos::df (const SinCos& B, gsl_vector* deriv, guint i, guint j) 
-{
-  dist (B); 
-  init_deriv ();
-  double d = daz (B);
-  if (i) {
-    *gsl_vector_ptr (deriv, 2*i-2) -= del (B);
-    if (i > 1) *gsl_vector_ptr (deriv, 2*i-3) -= d;
-  }
-  if (j) {
-    *gsl_vector_ptr (deriv, 2*j-2) -= rdel (B);
-    if (j > 1) *gsl_vector_ptr (deriv, 2*j-3) += d;
-  }
-}
+  opt = get_options (2); // restarts
+  guint nrestarts = opt.size() ? opt[0][0].get_int() : 1;
 
+  opt = get_options (3); // cutoff
+  float cutoff = opt.size() ? opt[0][0].get_float() * M_PI / 180.0 : 0.0;
 
-inline double SinCos::fdf (const SinCos& B, gsl_vector* deriv, guint i, guint j)
-{
-  df (B, deriv, i, j);
-  return (energy());
-}
+  guint ndirs = argument[0].get_int();
 
+  Math::RNG rng;
+  std::vector<guint> seeds (nrestarts);
+  for (guint n = 0; n < nrestarts; n++) 
+    seeds[n] = gsl_rng_get (rng());
 
-double energy_f (const gsl_vector *x, void *params)
-{
-  double  E = 0.0;
-  for (guint i = 0; i < ndirs; i++) {
-    SinCos I (x, i);
-    for (guint j = i+1; j < ndirs; j++) 
-      E += 2.0 *I.f (SinCos (x, j));
+  Math::Vector v;
+  ProgressBar::init (0, "Optimising directions");
+  if (nrestarts == 1) {
+    Thread::Progress progress;
+    optimise (ndirs, target_power, niter, cutoff, seeds[0], Thread::number(), true, v, progress);
+    progress.update();
   }
-  return (E);
-}
-
-
-
-void energy_df (const gsl_vector *x, void *params, gsl_vector *df)
-{
-  gsl_vector_set_zero (df);
-  for (guint i = 0; i < ndirs; i++) {
-    SinCos I (x, i);
-    for (guint j = i+1; j < ndirs; j++) 
-      I.df (SinCos (x, j), df, i, j);
+  else {
+    MultiStart multistart (ndirs, target_power, niter, cutoff, seeds);
+    {
+      Thread::Messages messages (nrestarts);
+      multistart.messages = &messages;
+      Thread::run (multistart, MIN (nrestarts, Thread::number()));
+    }
+    multistart.progress.update();
+    info ("best energy = " + str (multistart.best_energy));
+    v.copy (multistart.best);
   }
-}
+  ProgressBar::done();
 
 
 
-void energy_fdf (const gsl_vector *x, void *params, double *f, gsl_vector *df)
-{
-  *f = 0.0;
-  gsl_vector_set_zero (df);
-  for (guint i = 0; i < ndirs; i++) {
-    SinCos I (x, i);
-    for (guint j = i+1; j < ndirs; j++) 
-      *f += 2.0 * I.fdf (SinCos (x, j), df, i, j);
+  Math::Matrix directions (ndirs, 2);
+  directions(0,0) = 0.0;
+  directions(0,1) = 0.0;
+  directions(1,0) = 0.0;
+  directions(1,1) = v[0];
+  for (guint n = 2; n < ndirs; n++) {
+    double az = v[2*n-3];
+    double el = v[2*n-2];
+    range(az, el);
+    directions (n, 0) = az;
+    directions (n, 1) = el;
   }
-}
-
-
 
-
-
-inline void range (double& azimuth, double& elevation)
-{
-  while (elevation < 0.0) elevation += 2.0*M_PI;
-  while (elevation >= 2.0*M_PI) elevation -= 2.0*M_PI;
-  if (elevation >= M_PI) {
-    elevation = 2.0*M_PI - elevation;
-    azimuth -= M_PI;
-  }
-  while (azimuth < -M_PI) azimuth += 2.0*M_PI;
-  while (azimuth >= M_PI) azimuth -= 2.0*M_PI;
+  directions.save (argument[1].get_string());
 }
-
-
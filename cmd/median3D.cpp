@@ -20,8 +20,14 @@
 
 */
 
+#include <algorithm>
+
 #include "app.h"
 #include "image/position.h"
+#include "thread.h"
+
+// use a sorting network for windows of up to this many voxels:
+#define MAX_NETWORK_SIZE 32
 
 using namespace std; 
 using namespace MR; 
@@ -29,7 +35,8 @@ using namespace MR;
 SET_VERSION_DEFAULT;
 
 DESCRIPTION = {
- "smooth images using a 3x3x3 median filter.",
+ "smooth images using a median filter, or more generally a rank filter.",
+ "By default, a 3x3x3 median filter is used. Each output voxel is set to the given percentile of the intensities within the kernel centred on it, interpolating between the two nearest values where required (so that the median of an even number of values is the mean of the middle two). Near the edges of the image, only those voxels of the kernel that lie within the image are used. Images with more than 3 dimensions are filtered one volume at a time.",
   NULL
 };
 
@@ -40,80 +47,165 @@ ARGUMENTS = {
 };
 
 
-OPTIONS = { Option::End };
+OPTIONS = { 
+  Option ("extent", "kernel extent", "specify the extent of the kernel, either as a single value for all 3 axes, or as 3 comma-separated values (default: 3). All values must be odd.")
+    .append (Argument ("size", "size", "the size of the kernel.").type_sequence_int ()),
 
-EXECUTE {
-  Image::Object& in_obj (*argument[0].get_image());
-  in_obj.optimise();
+  Option ("percentile", "rank filter", "set each voxel to the specified percentile of the values within the kernel, rather than their median (i.e. 0 for an erosion filter, 100 for a dilation filter).")
+    .append (Argument ("value", "value", "the percentile to use.").type_float (0.0, 100.0, 50.0)),
+
+  Option::End 
+};
 
-  Image::Position in (in_obj);
-  Image::Header header (in.image.header());
-
-  Image::Position out (*argument[1].get_image (header));
-
-  int from[3], to[3], n, n1, n2, nc, i;
-  float val, v[14], cm, t;
-  bool avg;
-
-  ProgressBar::init (out.voxel_count(), "median filtering...");
-
-  do { 
-    for (out.set(2,0); out[2] < out.dim(2); out.inc(2)) {
-      from[2] = out[2] > 0 ? out[2]-1 : 0;
-      to[2] = out[2] < out.dim(2)-1 ? out[2]+2 : out.dim(2);
-      n2 = to[2]-from[2];
-      for (out.set(1,0); out[1] < out.dim(1); out.inc(1)) {
-        from[1] = out[1] > 0 ? out[1]-1 : 0;
-        to[1] = out[1] < out.dim(1)-1 ? out[1]+2 : out.dim(1);
-        n1 = n2*(to[1]-from[1]);
-        for (out.set(0,0); out[0] < out.dim(0); out.inc(0)) {
-          from[0] = out[0] > 0 ? out[0]-1 : 0;
-          to[0] = out[0] < out.dim(0)-1 ? out[0]+2 : out.dim(0);
-          n = n1*(to[0]-from[0]);
-          avg = (n+1)%2;
-          n = (n/2)+1;
-          nc = 0;
-          cm = GSL_NEGINF;
-
-          for (in.set(2,from[2]); in[2] < to[2]; in.inc(2)) {
-            for (in.set(1,from[1]); in[1] < to[1]; in.inc(1)) {
-              for (in.set(0,from[0]); in[0] < to[0]; in.inc(0)) {
-                val = in.value();
-                if (nc < n) {
-                  v[nc] = val;
-                  if (v[nc] > cm) cm = v[nc];
-                  nc++;
-                }
-                else if (val < cm) {
-                  for (i = 0; v[i] != cm; i++);
-                  v[i] = val;
-                  cm = GSL_NEGINF;
-                  for (i = 0; i < n; i++)
-                    if (v[i] > cm) cm = v[i];
-                }
-              }
-            }
-          }
 
-          if (avg) {
-            t = cm = GSL_NEGINF;
-            for (i = 0; i < n; i++) {
-              if (v[i] > cm) {
-                t = cm;
-                cm = v[i];
+
+
+
+// filters the image a row at a time, across multiple threads. For each row,
+// the values of the voxels within the kernel at each position along the row
+// are gathered once, so that the window for each output voxel is then a
+// contiguous range of these values. Small windows are sorted using a
+// branch-free sorting network, which the compiler can vectorise; larger ones
+// use std::nth_element().
+class RankFilter {
+  public:
+    RankFilter (Image::Object& input, Image::Object& output, const std::vector<int>& kernel_extent, float percentile) :
+      in_obj (input), out_obj (output), fraction (0.01*percentile),
+      nvolumes (input.voxel_count() / input.voxel_count(3)),
+      loop (nvolumes * input.dim(1) * input.dim(2), input.dim(1))
+    {
+      for (int n = 0; n < 3; n++) radius[n] = kernel_extent[n]/2;
+
+      // Batcher's odd-even merge sort, for the smallest power of 2 that
+      // can hold the full window:
+      gsize size = 1;
+      while (size < gsize (kernel_extent[0]*kernel_extent[1]*kernel_extent[2])) size <<= 1;
+      network_size = size <= MAX_NETWORK_SIZE ? size : 0;
+      for (gsize p = 1; p < network_size; p <<= 1) 
+        for (gsize k = p; k >= 1; k >>= 1) 
+          for (gsize j = k % p; j + k < network_size; j += 2*k) 
+            for (gsize i = 0; i < k && i + j + k < network_size; i++) 
+              if ((i+j) / (2*p) == (i+j+k) / (2*p)) {
+                network.push_back (i+j);
+                network.push_back (i+j+k);
               }
-              else if (v[i] > t) t = v[i];
-            }
-            cm = (cm+t)/2.0;
+    }
+
+    void execute () 
+    {
+      Image::Position in (in_obj);
+      Image::Position out (out_obj);
+      const int nx = in.dim(0);
+      std::vector<float> columns (nx * (2*radius[1]+1) * (2*radius[2]+1));
+      std::vector<float> window (MAX (network_size, gsize ((2*radius[0]+1) * (2*radius[1]+1) * (2*radius[2]+1))));
+      gsize first, last;
+
+      while (loop.next (first, last)) {
+        for (gsize row = first; row < last; row++) {
+          const int y = row % in.dim(1);
+          const int z = (row / in.dim(1)) % in.dim(2);
+          set_volume (in, out, row / (in.dim(1)*in.dim(2)));
+
+          // gather the voxels of the kernel, one column along x at a time:
+          const int y0 = MAX (y - radius[1], 0), y1 = MIN (y + radius[1], in.dim(1)-1);
+          const int z0 = MAX (z - radius[2], 0), z1 = MIN (z + radius[2], in.dim(2)-1);
+          const int m = (y1-y0+1) * (z1-z0+1);
+          int j = 0;
+          for (in.set(2,z0); in[2] <= z1; in.inc(2)) 
+            for (in.set(1,y0); in[1] <= y1; in.inc(1), j++) 
+              for (in.set(0,0); in[0] < nx; in.inc(0)) 
+                columns[in[0]*m + j] = in.value();
+
+          out.set (1, y);
+          out.set (2, z);
+          for (out.set(0,0); out[0] < nx; out.inc(0)) {
+            const int x0 = MAX (out[0] - radius[0], 0), x1 = MIN (out[0] + radius[0], nx-1);
+            out.value (rank_value (&columns[x0*m], (x1-x0+1)*m, window));
           }
+        }
+        progress.inc (last - first);
+      }
+    }
 
-          out.value (cm);
-          ProgressBar::inc();
+    Thread::Progress progress;
+
+  protected:
+    Image::Object& in_obj;
+    Image::Object& out_obj;
+    int radius[3];
+    const float fraction;
+    const gsize nvolumes;
+    gsize network_size;
+    std::vector<gsize> network;
+    Thread::Loop loop;
+
+    void set_volume (Image::Position& in, Image::Position& out, gsize volume) const
+    {
+      for (int n = 3; n < in.ndim(); n++) {
+        in.set (n, volume % in.dim(n));
+        out.set (n, in[n]);
+        volume /= in.dim(n);
+      }
+    }
+
+    float rank_value (const float* values, gsize count, std::vector<float>& window) const
+    {
+      const float pos = fraction * (count-1);
+      const gsize lower = gsize (pos);
+      const float f = pos - lower;
+      float* v = &window[0];
+      memcpy (v, values, count*sizeof (float));
+
+      if (network_size) {
+        for (gsize n = count; n < network_size; n++) 
+          v[n] = GSL_POSINF;
+        for (gsize n = 0; n < network.size(); n += 2) {
+          const float a = v[network[n]], b = v[network[n+1]];
+          v[network[n]] = a < b ? a : b;
+          v[network[n+1]] = a < b ? b : a;
         }
+        return (f > 0.0 ? v[lower] + f * (v[lower+1] - v[lower]) : v[lower]);
       }
+
+      std::nth_element (v, v + lower, v + count);
+      if (f == 0.0) return (v[lower]);
+      const float next = *std::min_element (v + lower + 1, v + count);
+      return (v[lower] + f * (next - v[lower]));
     }
-  } while (out++);
+};
+
+
+
+
 
+EXECUTE {
+  std::vector<int> extent (3, 3);
+  std::vector<OptBase> opt = get_options (0); // extent
+  if (opt.size()) {
+    extent = parse_ints (opt[0][0].get_string());
+    if (extent.size() == 1) extent.resize (3, extent[0]);
+    if (extent.size() != 3) 
+      throw Exception ("unexpected number of values for kernel extent - expected 1 or 3");
+    for (int n = 0; n < 3; n++) 
+      if (extent[n] < 1 || !(extent[n] & 1)) 
+        throw Exception ("kernel extent must be a positive odd number");
+  }
+
+  opt = get_options (1); // percentile
+  float percentile = opt.size() ? opt[0][0].get_float() : 50.0;
+
+  Image::Object& in_obj (*argument[0].get_image());
+  in_obj.optimise();
+
+  Image::Header header (in_obj.header());
+  Image::Object& out_obj (*argument[1].get_image (header));
+
+  in_obj.map();
+  out_obj.map();
+
+  RankFilter filter (in_obj, out_obj, extent, percentile);
+  ProgressBar::init (in_obj.voxel_count() / in_obj.dim(0), percentile == 50.0 ? "median filtering..." : "rank filtering...");
+  Thread::run (filter, header.data_type == DataType::Bit ? 1 : Thread::number());
+  filter.progress.update();
   ProgressBar::done();
 }
-
@@ -0,0 +1,106 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "app.h"
+#include "image/expression.h"
+
+using namespace std; 
+using namespace MR; 
+
+SET_VERSION_DEFAULT;
+
+DESCRIPTION = {
+  "compute the voxel-wise value of an expression involving one or more images.",
+  "The input images are referred to in the expression by a single letter, in the order supplied: 'a' for the first image, 'b' for the second, etc. Supported are the arithmetic operators + - * / % and ^ (power), the comparison operators < <= > >= == and !=, the logical operators && || and !, parentheses, numbers, the constants pi, inf and nan, and the functions abs, sqrt, exp, log, log10, sin, cos, tan, floor, ceil, round, isnan, min(x,y), max(x,y) and if(cond,x,y). Comparisons and logical operators evaluate to 1 if true and 0 otherwise.",
+  "The whole expression is evaluated in a single pass over the data, so that operations that would otherwise require several invocations of mradd, mrmult, mrabs or threshold can be performed without creating any intermediate images. For example, the mean absolute difference of two images, masked by a third, could be computed using the expression \"(abs(a-b)/2) * (c > 0.5)\".",
+  "Images whose dimension along an axis is 1 have their values repeated along that axis as required (e.g. to multiply each volume of a 4D image by the same 3D mask).",
+  NULL
+};
+
+ARGUMENTS = {
+  Argument ("expression", "expression", "the expression to be evaluated.").type_string (),
+  Argument ("input", "input image", "the input image(s), in the order in which they are referred to in the expression.", true, true).type_image_in (),
+  Argument ("output", "output image", "the output image.").type_image_out (),
+  Argument::End
+};
+
+const gchar* data_type_choices[] = { "FLOAT32", "FLOAT32LE", "FLOAT32BE", "FLOAT64", "FLOAT64LE", "FLOAT64BE", "FLOAT16", "FLOAT16LE", "FLOAT16BE", 
+    "INT32", "UINT32", "INT32LE", "UINT32LE", "INT32BE", "UINT32BE", 
+    "INT16", "UINT16", "INT16LE", "UINT16LE", "INT16BE", "UINT16BE", 
+    "INT8", "UINT8", "BIT", NULL };
+
+OPTIONS = { 
+  Option ("datatype", "data type", "specify output image data type (default: FLOAT32).")
+    .append (Argument ("spec", "specifier", "the data type specifier.").type_choice (data_type_choices)),
+
+  Option::End 
+};
+
+
+
+
+EXECUTE {
+  Image::Expression expression (argument[0].get_string());
+
+  guint num_images = argument.size()-2;
+  if (num_images != expression.num_inputs())
+    throw Exception ("expression refers to " + str(expression.num_inputs()) + " images, but " + str(num_images) + " were supplied");
+
+  std::vector< RefPtr<Image::Object> > in (num_images);
+  in[0] = argument[1].get_image();
+  Image::Header header (in[0]->header());
+
+  for (guint i = 1; i < num_images; i++) {
+    in[i] = argument[i+1].get_image();
+
+    if (in[i]->ndim() > header.axes.ndim()) 
+      header.axes.set_ndim (in[i]->ndim());
+
+    for (int n = 0; n < header.axes.ndim(); n++) { 
+      if (header.axes.dim[n] != in[i]->dim(n)) {
+        if (header.axes.dim[n] < 2) header.axes.copy (n, in[i]->header().axes, n);
+        else if (in[i]->dim(n) > 1) throw Exception ("dimension mismatch between input files");
+      }
+    }
+  }
+
+  header.data_type = DataType::Float32;
+  header.offset = 0.0;
+  header.scale = 1.0;
+
+  std::vector<OptBase> opt = get_options (0); // datatype
+  if (opt.size()) header.data_type.parse (data_type_choices[opt[0][0].get_int()]);
+
+  // the values of an image repeated along an axis are read again for each
+  // position along that axis, so only stream those that are read once:
+  for (guint i = 0; i < num_images; i++) {
+    bool repeated = false;
+    for (int n = 0; n < header.axes.ndim(); n++) 
+      if ((n < in[i]->ndim() ? in[i]->dim(n) : 1) != header.axes.dim[n]) repeated = true;
+    if (!repeated) in[i]->stream();
+  }
+
+  Image::Object& out_obj (*argument[num_images+1].get_image (header));
+  out_obj.stream();
+
+  expression.run (in, out_obj, "evaluating expression...");
+}
@@ -35,6 +35,7 @@
 #include "app.h"
 #include "image/position.h"
 #include "image/axis.h"
+#include "image/format/list.h"
 #include "math/linalg.h"
 
 using namespace std; 
@@ -56,7 +57,7 @@ ARGUMENTS = {
 
 
 const gchar* type_choices[] = { "REAL", "IMAG", "MAG", "PHASE", "COMPLEX", NULL };
-const gchar* data_type_choices[] = { "FLOAT32", "FLOAT32LE", "FLOAT32BE", "FLOAT64", "FLOAT64LE", "FLOAT64BE", 
+const gchar* data_type_choices[] = { "FLOAT32", "FLOAT32LE", "FLOAT32BE", "FLOAT64", "FLOAT64LE", "FLOAT64BE", "FLOAT16", "FLOAT16LE", "FLOAT16BE", 
     "INT32", "UINT32", "INT32LE", "UINT32LE", "INT32BE", "UINT32BE", 
     "INT16", "UINT16", "INT16LE", "UINT16LE", "INT16BE", "UINT16BE", 
     "CFLOAT32", "CFLOAT32LE", "CFLOAT32BE", "CFLOAT64", "CFLOAT64LE", "CFLOAT64BE", 
@@ -96,11 +97,57 @@ OPTIONS = {
   Option ("addcomment", "add comments", "add a new comment to the header.", false, true)
     .append (Argument ("comment", "comment", "the text to add as a comment.").type_string()),
 
+  Option ("reference", "refer to input data", "do not copy the data, but write an image header (.mih) that refers to the data in the input image file. "
+      "This is only possible if the input data are stored uncompressed in a single file, any coordinates selected are regularly spaced, "
+      "and no change of data type or layout is requested."),
+
   Option::End
 };
 
 
 
+inline bool regularly_spaced (const std::vector<int>& pos, int& from, int& step)
+{
+  from = pos[0];
+  step = pos.size() > 1 ? pos[1] - pos[0] : 1;
+  if (step == 0) return (false);
+  for (guint i = 1; i < pos.size(); i++) 
+    if (pos[i] - pos[i-1] != step) return (false);
+  return (true);
+}
+
+
+
+void write_reference (Image::Object& in_obj, const Image::Header& header, const std::vector< std::vector<int> >& pos, const std::vector<float>& vox, const String& output)
+{
+  std::vector<int> from (in_obj.ndim()), step (in_obj.ndim()), size (in_obj.ndim());
+  for (int n = 0; n < in_obj.ndim(); n++) {
+    if (!regularly_spaced (pos[n], from[n], step[n])) 
+      throw Exception ("coordinates selected along axis " + str (n) + " are not regularly spaced - cannot refer to input data");
+    size[n] = pos[n].size();
+  }
+
+  Image::Object view;
+  view.view (in_obj, from, step, size);
+
+  String file;
+  gsize offset;
+  Image::Header H (view.header());
+  if (!view.layout (H.axes, file, offset)) 
+    throw Exception ("data for image \"" + in_obj.name() + "\" are not stored in a form that can be referred to directly");
+
+  for (guint n = 0; n < vox.size(); n++) 
+    if (gsl_finite (vox[n])) H.axes.vox[n] = vox[n];
+  H.comments = header.comments;
+  H.DW_scheme = header.DW_scheme;
+
+  Image::Format::create_MRtrix_header (output, H, file, offset);
+}
+
+
+
+
+
 inline bool next (Image::Position& ref, Image::Position& other, const std::vector< std::vector<int> >& pos)
 {
   int axis = 0;
@@ -226,13 +273,32 @@ EXECUTE {
 
   in_obj.apply_scaling (scale, offset);
 
+  opt = get_options (11); // reference
+  if (opt.size()) {
+    if (get_options(2).size() || get_options(5).size() || get_options(6).size() || get_options(7).size())
+      throw Exception ("the -reference option cannot be combined with the -datatype, -zero, -output or -layout options");
+    write_reference (in_obj, header, pos, vox, argument[1].get_string());
+    return;
+  }
+
+
+
 
 
 
+  // the input is only accessed in order if the coordinates selected along
+  // each axis are in increasing order:
+  bool in_order = true;
+  for (guint n = 0; n < pos.size(); n++) 
+    for (guint i = 1; i < pos[n].size(); i++) 
+      if (pos[n][i] <= pos[n][i-1]) in_order = false;
+  if (in_order) in_obj.stream();
 
+  Image::Object& out_obj (*argument[1].get_image (header));
+  out_obj.stream();
 
   Image::Position in (in_obj);
-  Image::Position out (*argument[1].get_image (header));
+  Image::Position out (out_obj);
 
   for (int n = 0; n < in.ndim(); n++) in.set (n, pos[n][0]);
 
@@ -31,6 +31,7 @@
 
 #include "app.h"
 #include "image/position.h"
+#include "thread.h"
 
 using namespace std; 
 using namespace MR; 
@@ -39,6 +40,7 @@ SET_VERSION_DEFAULT;
 
 DESCRIPTION = {
   "compute images statistics.",
+  "The statistics are computed in a single pass through the data, using multiple threads. The percentiles and the histogram are derived from a summary of the intensities that is accurate to within 0.025% of their magnitude, so that no separate calibration pass is needed. If the histogram bins requested are narrower than this, the histogram is computed exactly in a second pass through the data.",
   NULL
 };
 
@@ -61,6 +63,9 @@ OPTIONS = {
   Option ("dump", "dump voxel intensities", "dump the voxel intensities to a text file.")
     .append (Argument ("file", "file", "the text file to dump the values into.").type_file ()),
 
+  Option ("percentiles", "compute percentiles", "also report the percentiles specified, as a comma-separated list of values between 0 and 100 (e.g. 25,50,75 for the median and inter-quartile range).")
+    .append (Argument ("values", "values", "the percentiles to compute.").type_sequence_float ()),
+
   Option::End 
 };
 
@@ -90,61 +95,130 @@ template <class Function> inline void loop (Image::Position& pos, RefPtr<Image::
 }
 
 
-class GetStats {
+
+
+// the number of mantissa bits used to index the fine bins of a Summary:
+#define FINE_BITS 12
+#define FINE_BINS (1U << FINE_BITS)
+
+// a summary of the values in one volume, which can be computed in parts and
+// merged. Besides the running sums, the values can be counted in a two-level
+// histogram indexed by their bit pattern: the sign & exponent select one of
+// 512 coarse bins, and the top FINE_BITS bits of the mantissa one of
+// FINE_BINS fine bins within it, allocated as needed. The fine bins are
+// therefore at most 1/FINE_BINS of their magnitude wide, whatever the range
+// of the data.
+class Summary {
   public:
-    GetStats () : mean (0.0), std (0.0), min (GSL_POSINF), max (GSL_NEGINF), count (0) { }
+    Summary (bool with_bins) : sum (0.0), sum2 (0.0), min (GSL_POSINF), max (GSL_NEGINF), count (0), coarse (with_bins ? 512 : 0) { }
 
-    double mean, std;
+    double sum, sum2;
     float min, max;
-    size_t count;
+    gsize count;
 
     void operator() (float val) {
-      mean += val;
-      std += val*val;
+      sum += val;
+      sum2 += double(val)*val;
       if (min > val) min = val;
       if (max < val) max = val;
       count++;
+      if (coarse.empty()) return;
+
+      guint32 bits;
+      memcpy (&bits, &val, sizeof (bits));
+      std::vector<gsize>& fine (coarse[bits >> 23]);
+      if (fine.empty()) fine.resize (FINE_BINS, 0);
+      fine[(bits >> (23-FINE_BITS)) & (FINE_BINS-1)]++;
+    }
+
+    void merge (const Summary& S) {
+      sum += S.sum;
+      sum2 += S.sum2;
+      if (min > S.min) min = S.min;
+      if (max < S.max) max = S.max;
+      count += S.count;
+      for (guint c = 0; c < coarse.size(); c++) {
+        if (S.coarse[c].empty()) continue;
+        if (coarse[c].empty()) coarse[c].resize (FINE_BINS, 0);
+        for (guint f = 0; f < FINE_BINS; f++) 
+          coarse[c][f] += S.coarse[c][f];
+      }
+    }
+
+    double mean () const { return (sum / double(count)); }
+    double std () const { double m = mean(); return (sqrt (sum2/double(count) - m*m)); }
+
+    // invoke func (lower, upper, count) for each non-empty fine bin, in
+    // order of increasing value:
+    template <class Functor> void for_each_bin (Functor& func) const {
+      for (guint c = 511; c >= 256; c--) 
+        if (coarse[c].size()) 
+          for (int f = FINE_BINS-1; f >= 0; f--) 
+            if (coarse[c][f]) 
+              func (-value (c, f+1), -value (c, f), coarse[c][f]);
+
+      for (guint c = 0; c < 256; c++) 
+        if (coarse[c].size()) 
+          for (guint f = 0; f < FINE_BINS; f++) 
+            if (coarse[c][f]) 
+              func (value (c, f), value (c, f+1), coarse[c][f]);
     }
-    
-    void finalise () {
-      if (count == 0) throw Exception ("no voxels in mask - aborting");
 
-      mean /= double(count);
-      std = sqrt(std/double(count) - mean*mean);
+  protected:
+    std::vector<std::vector<gsize> > coarse;
+
+    // the magnitude at the lower edge of fine bin f of coarse bin c:
+    static float value (guint c, guint f) {
+      guint32 bits = ( ( ( c & 0xFF ) << FINE_BITS ) + f ) << (23-FINE_BITS);
+      float val;
+      memcpy (&val, &bits, sizeof (val));
+      return (val);
     }
 };
 
 
-class GetMinMax {
-  public:
-    GetMinMax () : min (GSL_POSINF), max (GSL_NEGINF) { }
 
-    float min, max;
+// the value at the given percentile, interpolated linearly within the bin:
+class GetPercentile {
+  public:
+    GetPercentile (const Summary& summary, float percentile) : 
+      S (summary), rank (0.01 * percentile * summary.count), cumulative (0.0), result (GSL_NAN) { }
 
-    void operator() (float val) {
-      if (val < min) min = val;
-      if (val > max) max = val;
+    void operator() (float lower, float upper, gsize count) {
+      if (gsl_isnan (result) && cumulative + count >= rank) 
+        result = lower + (upper - lower) * (rank - cumulative) / double(count);
+      cumulative += count;
     }
+
+    float value () const { return (MAX (S.min, MIN (S.max, result))); }
+
+  protected:
+    const Summary& S;
+    double rank, cumulative;
+    double result;
 };
 
 
 
 class GetHistogram {
   public:
-    GetHistogram (const GetMinMax& limits, int nbins) : N (nbins), min (limits.min), width ((limits.max - limits.min) / float (N+1)), data (new size_t [N]) { }
-    ~GetHistogram () { delete [] data; }
+    GetHistogram (float minval, float maxval, int nbins) : N (nbins), min (minval), width ((maxval - minval) / float (N+1)), data (N, 0) { }
 
     int N;
     float min, width;
-    size_t* data;
+    std::vector<gsize> data;
 
-    void clear () { memset (data, 0, N*sizeof(size_t)); }
+    void operator() (float lower, float upper, gsize count) { data[index (0.5*(lower+upper))] += count; }
 
-    void operator() (float val) {
+    // to bin the values exactly, one at a time:
+    void operator() (float val) { data[index (val)]++; }
+
+  protected:
+    int index (float val) const {
       int bin = int ((val-min) / width);
       if (bin < 0) bin = 0;
       else if (bin >= N) bin = N-1;
-      data[bin]++;
+      return (bin);
     }
 };
 
@@ -164,9 +238,113 @@ class DumpValues {
 
 
 
+// summarises each volume, one plane at a time, across multiple threads:
+class Summariser {
+  public:
+    Summariser (Image::Object& image, Image::Object* mask_image, bool with_bins) : 
+      ima_obj (image), mask_obj (mask_image), nvolumes (image.voxel_count() / image.voxel_count(3)),
+      summaries (nvolumes), bins (with_bins), loop (nvolumes * image.dim(2)) { }
+
+    void execute () 
+    {
+      Image::Position ima (ima_obj);
+      RefPtr<Image::Position> mask;
+      if (mask_obj) mask = new Image::Position (*mask_obj);
+
+      // planes are handed out in order, so that each thread only needs to
+      // hold the summary of the volume it is currently working on:
+      RefPtr<Summary> local;
+      gsize volume = 0, first, last;
+
+      while (loop.next (first, last)) {
+        for (gsize n = first; n < last; n++) {
+          if (!local || volume != n / ima.dim(2)) {
+            if (local) merge (volume, local);
+            volume = n / ima.dim(2);
+            local = new Summary (bins);
+            set_volume (ima, volume);
+          }
+          ima.set (2, n % ima.dim(2));
+          if (mask) mask->set (2, ima[2]);
+
+          Summary& S (*local);
+
+          for (ima.set(1,0); ima[1] < ima.dim(1); ima.inc(1)) {
+            if (mask) mask->set (1, ima[1]);
+            for (ima.set(0,0); ima[0] < ima.dim(0); ima.inc(0)) {
+              if (mask) {
+                mask->set (0, ima[0]);
+                if (mask->value() < 0.5) continue;
+              }
+              float val = ima.value();
+              if (gsl_finite (val)) S (val);
+            }
+          }
+        }
+        progress.inc (last - first);
+      }
+
+      if (local) merge (volume, local);
+    }
+
+    void run () 
+    {
+      ProgressBar::init (loop.size(), "computing statistics...");
+      Thread::run (*this);
+      progress.update();
+      ProgressBar::done();
+
+      for (gsize n = 0; n < nvolumes; n++) 
+        if (!summaries[n]) summaries[n] = new Summary (bins);
+    }
+
+    void set_volume (Image::Position& ima, gsize volume) const 
+    {
+      for (int n = 3; n < ima.ndim(); n++) {
+        ima.set (n, volume % ima.dim(n));
+        volume /= ima.dim(n);
+      }
+    }
+
+    // the coordinates of the volume, as printed:
+    String label (gsize volume) const
+    {
+      String s = "[ ";
+      for (int n = 3; n < ima_obj.ndim(); n++) {
+        s += str (volume % ima_obj.dim(n)) + " ";
+        volume /= ima_obj.dim(n);
+      }
+      return (s + "] ");
+    }
+
+    Thread::Progress progress;
+
+    Image::Object& ima_obj;
+    Image::Object* mask_obj;
+    const gsize nvolumes;
+    std::vector<RefPtr<Summary> > summaries;
+
+  protected:
+    const bool bins;
+    Thread::Loop loop;
+    Glib::Mutex mutex;
+
+    void merge (gsize volume, RefPtr<Summary>& local)
+    {
+      Glib::Mutex::Lock lock (mutex);
+      if (summaries[volume]) summaries[volume]->merge (*local);
+      else summaries[volume] = local;
+    }
+};
+
+
+
+
 
 EXECUTE {
-  Image::Position ima (*argument[0].get_image());
+  Image::Object& ima_obj (*argument[0].get_image());
+  ima_obj.stream();
+  Image::Position ima (ima_obj);
 
   RefPtr<Image::Position> mask;
   std::vector<OptBase> opt = get_options (0); // mask
@@ -176,6 +354,36 @@ EXECUTE {
       throw Exception ("dimensions of mask image do not match that of data image - aborting");
   }
 
+  std::vector<float> percentiles;
+  opt = get_options (4); // percentiles
+  if (opt.size()) {
+    percentiles = parse_floats (opt[0][0].get_string());
+    for (guint n = 0; n < percentiles.size(); n++) 
+      if (percentiles[n] < 0.0 || percentiles[n] > 100.0) 
+        throw Exception ("percentiles must lie between 0 and 100");
+  }
+
+  Summariser summariser (ima_obj, mask ? &mask->image : NULL, percentiles.size() || get_options(1).size());
+  summariser.run();
+
+  String header ("channel         mean        std. dev.   min         max         count");
+  for (guint i = 0; i < percentiles.size(); i++) 
+    header += MR::printf ("       %-5s", ( "p" + str(percentiles[i]) ).c_str());
+  print (header + "\n");
+
+  for (gsize n = 0; n < summariser.nvolumes; n++) {
+    const Summary& stats (*summariser.summaries[n]);
+    if (stats.count == 0) throw Exception ("no voxels in mask - aborting");
+
+    String line = MR::printf ("%-15s %-11g %-11g %-11g %-11g %-11s", summariser.label(n).c_str(), stats.mean(), stats.std(), stats.min, stats.max, str(stats.count).c_str());
+    for (guint i = 0; i < percentiles.size(); i++) {
+      GetPercentile percentile (stats, percentiles[i]);
+      stats.for_each_bin (percentile);
+      line += MR::printf (" %-11g", percentile.value());
+    }
+    print (line + "\n");
+  }
+
 
 
   opt = get_options (1); // histogram
@@ -186,61 +394,49 @@ EXECUTE {
     size_t bins = 100;
     if (opt.size()) bins = opt[0][0].get_int();
 
-    size_t nrows = 1;
-    for (int i = 3; i < ima.ndim(); i++) nrows *= ima.dim(i);
-
-    // calibrate:
-    GetMinMax limits;
-    ProgressBar::init (nrows, "calibrating...");
-    do {
-      loop (ima, mask, limits);
-      ProgressBar::inc();
-    } while (ima++);
-    ProgressBar::done();
+    float min = GSL_POSINF, max = GSL_NEGINF;
+    for (gsize n = 0; n < summariser.nvolumes; n++) {
+      if (summariser.summaries[n]->min < min) min = summariser.summaries[n]->min;
+      if (summariser.summaries[n]->max > max) max = summariser.summaries[n]->max;
+    }
 
-    // get histogram:
-    GetHistogram hist (limits, bins);
     std::ofstream out (filename.c_str());
 
     // write out bin centres:
-    for (int i = 0; i < hist.N; i++)
-      out << (hist.min + hist.width/2.0) + i*hist.width << " ";
+    GetHistogram limits (min, max, bins);
+    for (int i = 0; i < limits.N; i++)
+      out << (limits.min + limits.width/2.0) + i*limits.width << " ";
     out << "\n";
 
-    ProgressBar::init (nrows, "building histogram...");
-    do {
-      hist.clear();
-      loop (ima, mask, hist);
+    // bins narrower than those of the summary would be filled unevenly, so
+    // the values are binned exactly in a second pass instead:
+    const bool exact = limits.width < MAX (fabs (min), fabs (max)) / FINE_BINS;
+    if (exact) ProgressBar::init (summariser.nvolumes, "computing histogram...");
+
+    for (gsize n = 0; n < summariser.nvolumes; n++) {
+      GetHistogram hist (min, max, bins);
+      if (exact) {
+        summariser.set_volume (ima, n);
+        loop (ima, mask, hist);
+        ProgressBar::inc();
+      }
+      else summariser.summaries[n]->for_each_bin (hist);
       for (int i = 0; i < hist.N; i++)
         out << hist.data[i] << " ";
       out << "\n";
-      ProgressBar::inc();
-    } while (ima++);
-    ProgressBar::done();
+    }
+    if (exact) ProgressBar::done();
 
     out.close();
   }
-  else {
-    bool header_shown = false;
-    do {
-      GetStats stats;
-      loop (ima, mask, stats);
-      stats.finalise();
-
-      String s = "[ ";
-      for (int n = 3; n < ima.ndim(); n++) s += str(ima[n]) + " ";
-      s += "] ";
 
-      if (!header_shown) print ("channel         mean        std. dev.   min         max         count\n");
-      header_shown = true;
-      print (MR::printf ("%-15s %-11g %-11g %-11g %-11g %-11d\n", s.c_str(), stats.mean, stats.std, stats.min, stats.max, stats.count));
-    } while (ima++);
-  }
 
   opt = get_options (3); // dump
   if (opt.size()) {
     DumpValues dump (opt[0][0].get_string());
     ProgressBar::init (ima.voxel_count(), "dumping values to file...");
+    // the histogram may have left the position on the last volume:
+    ima.zero();
     do {
       loop (ima, mask, dump);
       ProgressBar::inc();
@@ -248,4 +444,3 @@ EXECUTE {
     ProgressBar::done();
   }
 }
-
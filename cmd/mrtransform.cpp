@@ -23,6 +23,7 @@
 #include "app.h"
 #include "image/interp.h"
 #include "math/linalg.h"
+#include "thread.h"
 
 using namespace std; 
 using namespace MR; 
@@ -61,11 +62,181 @@ OPTIONS = {
   Option ("upsample", "upsample image", "reduce the output voxel size along all 3 axes by the factor specified. This is only used in conjunction with the -template option.")
     .append (Argument ("factor", "factor", "the factor by which to upsample.").type_float (1.0, 1.0e4, 2.0)),
 
+  Option ("cubic", "use cubic interpolation", "use tri-cubic rather than tri-linear interpolation. This is only used in conjunction with the -template option."),
+
   Option::End 
 };
 
 
 
+
+// reslices rows of the output image (along the x axis) across multiple
+// threads. The position in the input image is stepped incrementally along
+// each row, and the interpolation weights for each voxel are computed only
+// once and used for all volumes.
+class Reslicer {
+  public:
+    Reslicer (Image::Object& input, Image::Object& output, const float* transform, bool use_cubic) : 
+      in_obj (input), out_obj (output), cubic (use_cubic), loop (output.dim(1)*output.dim(2)) 
+    {
+      memcpy (R, transform, 12*sizeof(float));
+
+      // for axis-aligned transforms, the cubic weights along y & z are
+      // fixed for each row, and those along x are the same for all rows:
+      rows_aligned = R[4] == 0.0 && R[8] == 0.0;
+      cols_aligned = rows_aligned && R[1] == 0.0 && R[2] == 0.0;
+      if (cubic && cols_aligned) {
+        xweights.resize (out_obj.dim(0));
+        for (int x = 0; x < out_obj.dim(0); x++) 
+          xweights[x].set (R[0]*x + R[3], in_obj.dim(0));
+      }
+
+      // the coordinates along the non-spatial axes for each volume:
+      gsize nvolumes = output.voxel_count() / output.voxel_count (3);
+      volumes.resize (nvolumes);
+      for (gsize v = 0; v < nvolumes; v++) {
+        gsize i = v;
+        for (int n = 3; n < output.ndim(); n++) {
+          volumes[v].push_back (i % output.dim(n));
+          i /= output.dim(n);
+        }
+      }
+    }
+
+    void execute () 
+    {
+      Image::Interp in (in_obj);
+      Image::Position out (out_obj);
+      Weights X, Y, Z;
+      gsize first, last;
+
+      while (loop.next (first, last)) {
+        for (gsize row = first; row < last; row++) {
+          out.set (1, row % out.dim(1));
+          out.set (2, row / out.dim(1));
+
+          Point pos (
+              R[1]*out[1] + R[2]*out[2] + R[3],
+              R[5]*out[1] + R[6]*out[2] + R[7],
+              R[9]*out[1] + R[10]*out[2] + R[11]);
+
+          bool row_inside = true;
+          if (cubic && rows_aligned) 
+            row_inside = Y.set (pos[1], in.dim(1)) && Z.set (pos[2], in.dim(2));
+
+          for (out.set(0,0); out[0] < out.dim(0); out.inc(0)) {
+            if (!cubic) {
+              if (in.P (pos)) set_zero (out);
+              else {
+                for (guint v = 0; v < volumes.size(); v++) {
+                  set_volume (in, out, v);
+                  out.value (in.value());
+                }
+              }
+            }
+            else {
+              bool inside = row_inside;
+              if (inside) {
+                if (cols_aligned) X = xweights[out[0]];
+                else inside = X.set (pos[0], in.dim(0));
+              }
+              if (inside && !rows_aligned) 
+                inside = Y.set (pos[1], in.dim(1)) && Z.set (pos[2], in.dim(2));
+
+              if (!inside) set_zero (out);
+              else {
+                for (guint v = 0; v < volumes.size(); v++) {
+                  set_volume (in, out, v);
+                  out.value (cubic_value (in, X, Y, Z));
+                }
+              }
+            }
+
+            pos[0] += R[0];
+            pos[1] += R[4];
+            pos[2] += R[8];
+          }
+        }
+        progress.inc (last - first);
+      }
+    }
+
+    Thread::Progress progress;
+
+  protected:
+    // the voxels and weights for cubic interpolation along one axis:
+    class Weights {
+      public:
+        int   index[4];
+        float w[4];
+
+        // returns false if the position is outside the image:
+        bool  set (float p, int dim) 
+        {
+          if (p < -0.5 || p > dim - 0.5) return (false);
+          int i = int (floor (p));
+          float f = p - i;
+          w[0] = -f*(f-1.0)*(f-2.0)/6.0; 
+          w[1] = 0.5*(f+1.0)*(f-1.0)*(f-2.0); 
+          w[2] = -0.5*(f+1.0)*f*(f-2.0);
+          w[3] = (f+1.0)*f*(f-1.0)/6.0;
+          for (int n = 0; n < 4; n++) {
+            index[n] = i + n - 1;
+            if (index[n] < 0) index[n] = 0;
+            else if (index[n] >= dim) index[n] = dim-1;
+          }
+          return (true);
+        }
+    };
+
+    Image::Object& in_obj;
+    Image::Object& out_obj;
+    float R[12];
+    bool cubic, rows_aligned, cols_aligned;
+    std::vector<Weights> xweights;
+    std::vector< std::vector<int> > volumes;
+    Thread::Loop loop;
+
+    void set_volume (Image::Position& in, Image::Position& out, guint v) const
+    {
+      for (guint n = 0; n < volumes[v].size(); n++) {
+        in.set (n+3, volumes[v][n]);
+        out.set (n+3, volumes[v][n]);
+      }
+    }
+
+    void set_zero (Image::Position& out) const
+    {
+      for (guint v = 0; v < volumes.size(); v++) {
+        for (guint n = 0; n < volumes[v].size(); n++) 
+          out.set (n+3, volumes[v][n]);
+        out.value (0.0);
+      }
+    }
+
+    float cubic_value (Image::Position& in, const Weights& X, const Weights& Y, const Weights& Z) const
+    {
+      float val = 0.0;
+      for (int k = 0; k < 4; k++) {
+        in.set (2, Z.index[k]);
+        float plane = 0.0;
+        for (int j = 0; j < 4; j++) {
+          in.set (1, Y.index[j]);
+          float row = 0.0;
+          for (int i = 0; i < 4; i++) {
+            in.set (0, X.index[i]);
+            row += X.w[i] * in.value();
+          }
+          plane += Y.w[j] * row;
+        }
+        val += Z.w[k] * plane;
+      }
+      return (val);
+    }
+};
+
+
+
 EXECUTE {
   Math::Matrix T(4,4);
   T.identity();
@@ -171,31 +342,17 @@ EXECUTE {
     };
 
     in_obj.optimise();
-    Image::Interp in (in_obj);
-    Image::Position out (*argument[1].get_image (header));
-    Point pos;
+    in_obj.map();
+    Image::Object& out_obj (*argument[1].get_image (header));
+    out_obj.map();
 
-    ProgressBar::init (out.voxel_count(), "reslicing image...");
-    do { 
-      for (int n = 3; n < out.ndim(); ++n)
-        in.set (n, out[n]);
-      for (out.set(2,0); out[2] < out.dim(2); out.inc(2)) {
-        for (out.set(1,0); out[1] < out.dim(1); out.inc(1)) {
-          pos[0] = R[1]*out[1] + R[2]*out[2] + R[3];
-          pos[1] = R[5]*out[1] + R[6]*out[2] + R[7];
-          pos[2] = R[9]*out[1] + R[10]*out[2] + R[11];
-          for (out.set(0,0); out[0] < out.dim(0); out.inc(0)) {
-            in.P (pos);
-            if (!in) out.value (0.0);
-            else out.value (in.value());
-            pos[0] += R[0];
-            pos[1] += R[4];
-            pos[2] += R[8];
-            ProgressBar::inc();
-          }
-        }
-      }
-    } while (out++);
+    // bitwise data would be modified a byte at a time by different threads:
+    guint num_threads = out_obj.header().data_type == DataType::Bit ? 1 : Thread::number();
+
+    Reslicer reslicer (in_obj, out_obj, R, get_options(7).size());
+    ProgressBar::init (out_obj.dim(1)*out_obj.dim(2), "reslicing image...");
+    Thread::run (reslicer, num_threads);
+    reslicer.progress.update();
     ProgressBar::done();
   }
   else {
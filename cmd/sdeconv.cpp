@@ -28,8 +28,7 @@
 */
 
 #include "app.h"
-#include "ptr.h"
-#include "image/position.h"
+#include "image/slab_product.h"
 #include "math/linalg.h"
 #include "dwi/gradient.h"
 #include "dwi/SH.h"
@@ -182,63 +181,16 @@ EXECUTE {
   header.axes.axis[2] = 3; header.axes.forward[2] = true;
   header.axes.axis[3] = 0; header.axes.forward[3] = true;
 
-  Image::Position dwi (dwi_obj);
-  Image::Position sh (*argument[2].get_image (header));
+  Image::Object& sh_obj (*argument[2].get_image (header));
 
-  opt = get_options (2);
-  Ptr<Image::Position> mask;
-  if (opt.size()) 
-    mask = new Image::Position (*opt[0][0].get_image());
-
-  DWI::SH::Coefs res (lmax);
-  Math::Vector sigs (dwis.size());
-
-
-  bool normalise = get_options(4).size();
-
-  ProgressBar::init (dwi.dim(0)*dwi.dim(1)*dwi.dim(2), "performing spherical deconvolution...");
-
-  for (dwi.set(2,0), sh.set(2,0); dwi[2] < dwi.dim(2); dwi.inc(2), sh.inc(2)) {
-    if (mask.get()) mask->set(2, dwi[2]);
-
-    for (dwi.set(1,0), sh.set(1,0); dwi[1] < dwi.dim(1); dwi.inc(1), sh.inc(1)) {
-      if (mask.get()) mask->set(1, dwi[1]);
+  Image::SlabProduct deconv (dwi_obj, sh_obj, SHT.mat_A2SH());
+  deconv.set_volumes (dwis);
+  deconv.set_clamp_negative ();
 
-      for (dwi.set(0,0), sh.set(0,0); dwi[0] < dwi.dim(0); dwi.inc(0), sh.inc(0)) {
-        bool proceed = true;
-        if (mask.get()) {
-          mask->set(0, dwi[0]);
-          if (mask->value() < 0.5) proceed = false;
-        }
-
-        if (proceed) {
-          double norm = 0.0;
-          if (normalise) {
-            for (guint n = 0; n < bzeros.size(); n++) {
-              dwi.set (3, bzeros[n]);
-              norm += dwi.value ();
-            }
-            norm /= bzeros.size();
-          }
-
-          for (guint n = 0; n < dwis.size(); n++) {
-            dwi.set (3, dwis[n]);
-            sigs[n] = dwi.value(); 
-            if (sigs[n] < 0.0) sigs[n] = 0.0;
-            if (normalise) sigs[n] /= norm;
-          }
-
-          SHT.A2SH (res, sigs);
-
-          for (sh.set(3,0); sh[3] < sh.dim(3); sh.inc(3))
-            sh.value (res.V[sh[3]]);
-        }
-
-        ProgressBar::inc();
-      }
-    }
-  }
+  opt = get_options (2);
+  if (opt.size()) deconv.set_mask (*opt[0][0].get_image());
 
-  ProgressBar::done();
+  if (get_options(4).size()) deconv.set_normalisation (bzeros);
+  deconv.run ("performing spherical deconvolution...");
 }
 
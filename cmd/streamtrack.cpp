@@ -73,6 +73,7 @@ DESCRIPTION = {
 };
 
 const gchar* type_choices[] = { "DT_STREAM", "DT_PROB", "SD_STREAM", "SD_PROB", NULL };
+const gchar* rng_choices[] = { "XOSHIRO", "MT19937", NULL };
 
 ARGUMENTS = {
 
@@ -202,6 +203,25 @@ OPTIONS = {
       "do NOT pre-compute legendre polynomial values. "
       "Warning: this will slow down the algorithm by a factor of approximately 4."),
 
+  Option ("downsample", "downsample tracks", 
+      "remove nearly collinear points from the tracks as they are written, "
+      "keeping each track within the tolerance specified of its original path. "
+      "The distance between the points retained is limited to 5 times the step size.")
+    .append (Argument ("tolerance", "tolerance",
+          "the maximum deviation from the original track, in mm.").type_float (1e-6, 10.0, 0.02)),
+
+  Option ("tensorfield", "pre-compute tensor field", 
+      "fit the diffusion tensor in every voxel before tracking, and interpolate "
+      "the tensor components rather than the DW signal at each step "
+      "(DT_STREAM only). This is much faster for data sets with many DW "
+      "directions, but requires enough memory to hold 6 volumes."),
+
+  Option ("rng", "random number generator", 
+      "set the pseudo-random number generator used for seeding and probabilistic "
+      "tracking. Allowed values are xoshiro (the default, and the fastest) and "
+      "mt19937 (the Mersenne Twister, as used by previous versions).")
+    .append (Argument ("type", "generator type", "the generator to use.").type_choice (rng_choices)),
+
   Option::End
 };
 
@@ -235,8 +255,15 @@ class Threader {
             Math::Matrix bmat;
             grad2bmatrix (bmat, binv);
             Math::invert (binv, bmat);
+            Image::Object* dt_source = &source;
+            Properties::const_iterator precomputed = properties.find ("dt_precomputed");
+            if (precomputed != properties.end() && precomputed->second == "1") {
+              Tracker::DTStream::fit_tensor_field (source, binv, tensor_field);
+              dt_source = &tensor_field;
+            }
             for (int n = 0; n < num_threads; n++) 
-              trackers[n] = new Tracker::DTStream (source, properties, binv);
+              trackers[n] = new Tracker::DTStream (*dt_source, properties, binv);
+            properties["source"] = source.name();
           }
           break;
         case 2: 
@@ -261,6 +288,10 @@ class Threader {
       unidirectional = to<int> (properties["unidirectional"]);
       min_size = MR::round (to<float> (properties["min_dist"]) / to<float> (properties["step_size"]));
 
+      // operator[] would add an empty entry to the header if not set:
+      Properties::const_iterator tolerance = properties.find ("downsample_tolerance");
+      if (tolerance != properties.end()) 
+        writer.set_downsampling (to<float> (tolerance->second), 5.0 * to<float> (properties["step_size"]));
       writer.create (output_file, properties);
     }
 
@@ -287,6 +318,7 @@ class Threader {
 
   protected:
     Math::Matrix binv;
+    Image::Object tensor_field;
     const Point init_dir;
     const float init_dir_tolerance_dp;
     guint max_num_tracks, max_num_attempts, min_size;
@@ -476,7 +508,19 @@ EXECUTE {
   opt = get_options (18); // noprecomputed
   if (opt.size()) properties["sh_precomputed"] = "0";
 
-  Glib::thread_init();
+  opt = get_options (19); // downsample
+  if (opt.size()) properties["downsample_tolerance"] = str (opt[0][0].get_float());
+
+  opt = get_options (20); // tensorfield
+  if (opt.size()) {
+    if (argument[0].get_int() != 0) 
+      throw Exception ("the -tensorfield option can only be used with DT_STREAM tracking");
+    properties["dt_precomputed"] = "1";
+  }
+
+  opt = get_options (21); // rng
+  if (opt.size()) properties["rng"] = lowercase (rng_choices[opt[0][0].get_int()]);
+
   Threader thread (argument[0].get_int(), *argument[1].get_image(), argument[2].get_string(), properties, init_dir, init_dir_tolerance, grad);
   thread.run();
 }
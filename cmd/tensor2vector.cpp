@@ -22,7 +22,7 @@
 
 #include "app.h"
 #include "image/position.h"
-#include "math/linalg.h"
+#include "math/eig3.h"
 
 using namespace std; 
 using namespace MR; 
@@ -57,10 +57,8 @@ EXECUTE {
   header.axes.dim[3] = 3;
   header.data_type = DataType::Float32;
 
-  Math::Matrix V(3,3), M(3,3);
-  double ev[3];
-
-  Math::eig_init (M, true);
+  double V[3][3], ev[3];
+  float el[6];
 
   Image::Position dt (dt_obj);
   Image::Position vec (*argument[1].get_image (header));
@@ -71,26 +69,19 @@ EXECUTE {
     for (dt.set(1,0), vec.set(1,0); dt[1] < dt.dim(1); dt.inc(1), vec.inc(1)) {
       for (dt.set(0,0), vec.set(0,0); dt[0] < dt.dim(0); dt.inc(0), vec.inc(0)) {
 
-        dt.set(3,0);
-
-        M(0,0) = dt.value();          dt.inc(3);
-        M(1,1) = dt.value();          dt.inc(3);
-        M(2,2) = dt.value();          dt.inc(3);
-        M(0,1) = M(1,0) = dt.value(); dt.inc(3);
-        M(0,2) = M(2,0) = dt.value(); dt.inc(3);
-        M(1,2) = M(2,1) = dt.value(); 
+        for (dt.set(3,0); dt[3] < 6; dt.inc(3)) 
+          el[dt[3]] = dt.value();
 
-        Math::eig (M, ev, V);
+        Math::eig3 (el, ev, V);
 
         vec.set(3,0);
-        vec.value (V(0,2)); vec.inc(3);
-        vec.value (V(1,2)); vec.inc(3);
-        vec.value (V(2,2));
+        vec.value (V[0][2]); vec.inc(3);
+        vec.value (V[1][2]); vec.inc(3);
+        vec.value (V[2][2]);
 
         ProgressBar::inc();
       }
     }
   }
   ProgressBar::done();
-  Math::eig_end();
 }
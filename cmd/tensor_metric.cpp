@@ -22,7 +22,7 @@
 
 #include "app.h"
 #include "image/position.h"
-#include "math/linalg.h"
+#include "math/eig3.h"
 #include "dwi/tensor.h"
 
 using namespace std; 
@@ -124,11 +124,12 @@ EXECUTE {
     vals[i] = 3-vals[i];
  
 
-  Math::Matrix V(3,3), M(3,3);
-  double ev[3];
-  float el[6];
+  double V[3][3], ev[3];
 
-  Math::eig_init (M, evec);
+  // tensors are processed a row at a time, so that their eigenvalues can
+  // be computed in a single batch when the eigenvectors are not needed:
+  std::vector<float> row (6*dt.dim(0));
+  std::vector<double> row_ev (3*dt.dim(0));
 
   ProgressBar::init (dt.dim(0)*dt.dim(1)*dt.dim(2), "computing tensor metrics...");
 
@@ -144,6 +145,13 @@ EXECUTE {
       if (adc) adc->set(0,0); 
       if (eval) eval->set(0,0); 
       if (evec) evec->set(0,0);
+
+      for (dt.set(0,0); dt[0] < dt.dim(0); dt.inc(0)) 
+        for (dt.set(3,0); dt[3] < dt.dim(3); dt.inc(3)) 
+          row[6*dt[0]+dt[3]] = dt.value();
+
+      if (eval && !evec) Math::eig3 (&row[0], &row_ev[0], dt.dim(0));
+
       for (dt.set(0,0); dt[0] < dt.dim(0); dt.inc(0)) {
 
         bool skip = false;
@@ -151,34 +159,27 @@ EXECUTE {
 
         if (!skip) {
 
-          for (dt.set(3,0); dt[3] < dt.dim(3); dt.inc(3)) 
-            el[dt[3]] = dt.value();
+          float* el = &row[6*dt[0]];
 
           if (adc) adc->value (DWI::tensor2ADC (el));
           if (fa) fa->value (DWI::tensor2FA (el));
 
           if (eval || evec) {
-            M(0,0) = el[0];
-            M(1,1) = el[1];
-            M(2,2) = el[2];
-            M(0,1) = M(1,0) = el[3];
-            M(0,2) = M(2,0) = el[4];
-            M(1,2) = M(2,1) = el[5];
-
+            const double* e = ev;
             if (evec) {
-              Math::eig (M, ev, V);
+              Math::eig3 (el, ev, V);
               evec->set(3,0);
               for (size_t i = 0; i < vals.size(); i++) {
-                evec->value (V(0,vals[i])); evec->inc(3);
-                evec->value (V(1,vals[i])); evec->inc(3);
-                evec->value (V(2,vals[i])); evec->inc(3);
+                evec->value (V[0][vals[i]]); evec->inc(3);
+                evec->value (V[1][vals[i]]); evec->inc(3);
+                evec->value (V[2][vals[i]]); evec->inc(3);
               }
             }
-            else Math::eig (M, ev);
+            else e = &row_ev[3*dt[0]];
 
             if (eval) {
               for (eval->set(3,0); (*eval)[3] < (int) vals.size(); eval->inc(3))
-                eval->value (ev[vals[(*eval)[3]]]); 
+                eval->value (e[vals[(*eval)[3]]]); 
             }
           }
         }
@@ -205,6 +206,5 @@ EXECUTE {
   }
 
   ProgressBar::done();
-  Math::eig_end();
 }
 
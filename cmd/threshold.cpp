@@ -90,7 +90,11 @@ EXECUTE {
   const bool invert  =  get_options(3).size();
   const bool use_NaN =  get_options(4).size();
 
-  Image::Position in (*argument[0].get_image());
+  Image::Object& in_obj (*argument[0].get_image());
+  // the input needs to be read twice to compute its range or histogram:
+  if (!use_percentage && !optimise) in_obj.stream();
+
+  Image::Position in (in_obj);
   Image::Header header (in.image.header());
 
   if (in.is_complex()) header.data_type = DataType::CFloat32;
@@ -102,7 +106,9 @@ EXECUTE {
     header.scale = 1.0;
   }
 
-  Image::Position out (*argument[1].get_image (header));
+  Image::Object& out_obj (*argument[1].get_image (header));
+  out_obj.stream();
+  Image::Position out (out_obj);
 
   if (use_percentage) {
     float min, max;
@@ -39,7 +39,7 @@
 
 
 #include "app.h"
-#include "math/matrix.h"
+#include "math/small_matrix.h"
 #include "dwi/tractography/file.h"
 #include "dwi/tractography/properties.h"
 
@@ -47,7 +47,7 @@
 #include <stdint.h>
 
 
-const gchar* data_type_choices[] = { "FLOAT32", "FLOAT32LE", "FLOAT32BE", "FLOAT64", "FLOAT64LE", "FLOAT64BE",
+const gchar* data_type_choices[] = { "FLOAT32", "FLOAT32LE", "FLOAT32BE", "FLOAT64", "FLOAT64LE", "FLOAT64BE", "FLOAT16", "FLOAT16LE", "FLOAT16BE",
     "INT32", "UINT32", "INT32LE", "UINT32LE", "INT32BE", "UINT32BE",
     "INT16", "UINT16", "INT16LE", "UINT16LE", "INT16BE", "UINT16BE",
     "CFLOAT32", "CFLOAT32LE", "CFLOAT32BE", "CFLOAT64", "CFLOAT64LE", "CFLOAT64BE",
@@ -199,19 +199,21 @@ class Resampler
 {
 
   public:
-    Resampler (const Math::Matrix& interp_matrix, const unsigned int c) :
-      M (interp_matrix),
-      columns (c),
-      data (4, c) { }
+    Resampler (const Math::Matrix& interp_matrix) :
+      weights (interp_matrix.rows())
+    {
+      for (unsigned int i = 0; i != weights.size(); ++i)
+        for (unsigned int j = 0; j != 4; ++j)
+          weights[i][j] = interp_matrix(i,j);
+    }
 
     ~Resampler() { }
 
-    unsigned int get_columns () const { return (columns); }
-    bool valid () const { return (M.is_valid()); }
+    bool valid () const { return (weights.size()); }
 
-    void init (const float* a, const float* b, const float* c)
+    void init (const Point& a, const Point& b, const Point& c)
     {
-      for (unsigned int i = 0; i != columns; ++i) {
+      for (unsigned int i = 0; i != 3; ++i) {
         data(0,i) = 0.0;
         data(1,i) = a[i];
         data(2,i) = b[i];
@@ -219,9 +221,9 @@ class Resampler
       }
     }
 
-    void increment (const float* a)
+    void increment (const Point& a)
     {
-      for (unsigned int i = 0; i != columns; ++i) {
+      for (unsigned int i = 0; i != 3; ++i) {
         data(0,i) = data(1,i);
         data(1,i) = data(2,i);
         data(2,i) = data(3,i);
@@ -229,15 +231,18 @@ class Resampler
       }
     }
 
-    void interpolate (Math::Matrix& result) const
+    void interpolate (std::vector<Point>& out) const
     {
-      result.multiply (M, data);
+      Math::SmallVector<float,3> p;
+      for (unsigned int row = 0; row != weights.size(); ++row) {
+        p.multiply_trans (data, weights[row]);
+        out.push_back (Point (p[0], p[1], p[2]));
+      }
     }
 
   private:
-    const Math::Matrix& M;
-    const unsigned int columns;
-    Math::Matrix data;
+    std::vector< Math::SmallVector<float,4> > weights;
+    Math::SmallMatrix<float,4,3> data;
 
 };
 
@@ -252,18 +257,12 @@ template <class T> class TrackMapper
     TrackMapper (const Image::Position& pos, const Math::Matrix& interp_matrix) :
       H (pos.image.header()),
       interp (pos.image),
-      resample_matrix (interp_matrix),
-      R (resample_matrix, 3) { }
+      R (interp_matrix) { }
 
     void map (std::vector<Point>& tck, T& output)
     {
-      Math::Matrix data;
-      if (R.valid()) {
-        assert (resample_matrix.is_valid());
-        assert (resample_matrix.rows());
-        data.allocate (resample_matrix.rows(), 3);
-        interp_track (tck, R, data);
-      }
+      if (R.valid()) 
+        interp_track (tck);
       voxelise (tck, output);
     }
 
@@ -271,8 +270,8 @@ template <class T> class TrackMapper
   private:
     const Image::Header& H;
     Image::Interp interp;
-    const Math::Matrix& resample_matrix;
     Resampler R;
+    std::vector<Point> out;
 
 
     void tck_interp_prepare (std::vector<Point>& v)
@@ -282,20 +281,15 @@ template <class T> class TrackMapper
       v.push_back (           v[ s ] + (2 * (v[ s ] - v[s-1])) - (v[s-1] - v[s-2]));
     }
 
-    void interp_track (
-        std::vector<Point>& tck,
-        Resampler& R,
-        Math::Matrix& data)
+    void interp_track (std::vector<Point>& tck)
     {
-      std::vector<Point> out;
+      out.clear();
       tck_interp_prepare (tck);
-      R.init (tck[0].get(), tck[1].get(), tck[2].get());
+      R.init (tck[0], tck[1], tck[2]);
       for (unsigned int i = 3; i < tck.size(); ++i) {
         out.push_back (tck[i-2]);
-        R.increment (tck[i].get());
-        R.interpolate (data);
-        for (unsigned int row = 0; row != data.rows(); ++row)
-          out.push_back (Point (data(row,0), data(row,1), data(row,2)));
+        R.increment (tck[i]);
+        R.interpolate (out);
       }
       out.push_back (tck[tck.size() - 2]);
       out.swap (tck);
@@ -344,6 +338,9 @@ template<> void TrackMapper<SetVoxelDir>::voxelise (const std::vector<Point>& tc
 
 
 
+// the output image is newly created and hence zero-filled, so only non-zero
+// voxels are written: for sparse output images (.msf), empty blocks are then
+// never touched.
 template <class T> class MapWriterBase
 {
 
@@ -404,7 +401,7 @@ MapWriter<uint32_t>::~MapWriter<uint32_t> ()
   for (pos.set(2,0); pos[2] < H.dim(2); pos.inc(2)) {
     for (pos.set(1,0); pos[1] < H.dim(1); pos.inc(1)) {
       for (pos.set(0,0); pos[0] < H.dim(0); pos.inc(0), ++index)
-        pos.value (buffer[index]);
+        if (buffer[index]) pos.value (buffer[index]);
     }
     ProgressBar::inc();
   }
@@ -422,7 +419,7 @@ MapWriter<float>::~MapWriter<float> ()
   for (pos.set(2,0); pos[2] < H.dim(2); pos.inc(2)) {
     for (pos.set(1,0); pos[1] < H.dim(1); pos.inc(1)) {
       for (pos.set(0,0); pos[0] < H.dim(0); pos.inc(0), ++index)
-        pos.value (scale * buffer[index]);
+        if (buffer[index]) pos.value (scale * buffer[index]);
     }
     ProgressBar::inc();
   }
@@ -469,6 +466,7 @@ class MapWriterColour : public MapWriterBase<SetVoxelDir>
       for (pos.set(2,0); pos[2] < H.dim(2); pos.inc(2)) {
         for (pos.set(1,0); pos[1] < H.dim(1); pos.inc(1)) {
           for (pos.set(0,0); pos[0] < H.dim(0); pos.inc(0), ++index) {
+            if (!buffer[index][0] && !buffer[index][1] && !buffer[index][2]) continue;
             pos.set(3, 0); pos.value ((buffer[index])[0]);
             pos.inc(3);    pos.value ((buffer[index])[1]);
             pos.inc(3);    pos.value ((buffer[index])[2]);
@@ -638,7 +636,9 @@ EXECUTE {
 
   const size_t num_tracks       = properties["count"]      .empty() ? 0   : to<size_t> (properties["count"]);
   const size_t total_num_tracks = properties["total_count"].empty() ? 0   : to<size_t> (properties["total_count"]);
-  const float  step_size        = properties["step_size"]  .empty() ? 0.0 : to<float>  (properties["step_size"]);
+  // tracks that have been downsampled are only guaranteed to be sampled at max_step_size:
+  const float  step_size        = properties["max_step_size"].size() ? to<float> (properties["max_step_size"]) : 
+                                ( properties["step_size"]  .empty() ? 0.0 : to<float>  (properties["step_size"]) );
 
   const bool colour                  = get_options (2).size();
   const bool fibre_fraction          = get_options (3).size();
@@ -32,6 +32,7 @@
 */
 
 #include <glibmm/stringutils.h>
+#include <glibmm/thread.h>
 
 #include "app.h"
 #include "svn_revision.h"
@@ -225,6 +226,9 @@ namespace MR {
     sort_arguments (argc, argv); 
 
     srand (time (NULL));
+
+    // initialise the thread system before any mutexes get created:
+    if (!Glib::thread_supported()) Glib::thread_init();
       
     File::Config::init ();
   }
@@ -43,6 +43,7 @@ namespace MR {
   const guchar DataType::UInt32;
   const guchar DataType::Float32;
   const guchar DataType::Float64;
+  const guchar DataType::Float16;
   const guchar DataType::Int8;
   const guchar DataType::Int16;
   const guchar DataType::Int16LE;
@@ -54,6 +55,8 @@ namespace MR {
   const guchar DataType::UInt32LE;
   const guchar DataType::Int32BE;
   const guchar DataType::UInt32BE;
+  const guchar DataType::Float16LE;
+  const guchar DataType::Float16BE;
   const guchar DataType::Float32LE;
   const guchar DataType::Float32BE;
   const guchar DataType::Float64LE;
@@ -78,6 +81,10 @@ namespace MR {
     if (str == "float32le")  { dt = Float32LE;   return; }
     if (str == "float32be")  { dt = Float32BE;   return; }
  
+    if (str == "float16")    { dt = Float16;     return; }
+    if (str == "float16le")  { dt = Float16LE;   return; }
+    if (str == "float16be")  { dt = Float16BE;   return; }
+ 
     if (str == "float64")    { dt = Float64;     return; }
     if (str == "float64le")  { dt = Float64LE;   return; }
     if (str == "float64be")  { dt = Float64BE;   return; }
@@ -137,6 +144,10 @@ namespace MR {
       case Int32BE:
       case UInt32BE:
         return (8*sizeof (gint32));
+      case Float16:
+      case Float16LE:
+      case Float16BE:
+        return (16);
       case Float32:
       case Float32LE:
       case Float32BE:
@@ -178,6 +189,9 @@ namespace MR {
       case Int32BE:    return ("signed 32 bit integer (big endian)");
       case UInt32BE:   return ("unsigned 32 bit integer (big endian)");
 
+      case Float16LE:  return ("16 bit float (little endian)");
+      case Float16BE:  return ("16 bit float (big endian)");
+
       case Float32LE:  return ("32 bit float (little endian)");
       case Float32BE:  return ("32 bit float (big endian)");
 
@@ -221,6 +235,9 @@ namespace MR {
       case Int32BE:    return ("Int32BE");
       case UInt32BE:   return ("UInt32BE");
 
+      case Float16LE:  return ("Float16LE");
+      case Float16BE:  return ("Float16BE");
+
       case Float32LE:  return ("Float32LE");
       case Float32BE:  return ("Float32BE");
 
@@ -237,6 +254,7 @@ namespace MR {
       case UInt16:     return ("UInt16");
       case Int32:      return ("Int32");
       case UInt32:     return ("UInt32");
+      case Float16:    return ("Float16");
       case Float32:    return ("Float32");
       case Float64:    return ("Float64");
       case CFloat32:   return ("CFloat32");
@@ -77,6 +77,7 @@ namespace MR {
       static const guchar     UInt32        = 0x04U;
       static const guchar     Float32       = 0x05U;
       static const guchar     Float64       = 0x06U;
+      static const guchar     Float16       = 0x07U;
 
       static const guchar     Int8          = UInt8  | Signed;
       static const guchar     Int16         = UInt16 | Signed;
@@ -89,6 +90,8 @@ namespace MR {
       static const guchar     UInt32LE      = UInt32 | LittleEndian;
       static const guchar     Int32BE       = UInt32 | Signed | BigEndian;
       static const guchar     UInt32BE      = UInt32 | BigEndian;
+      static const guchar     Float16LE     = Float16 | LittleEndian;
+      static const guchar     Float16BE     = Float16 | BigEndian;
       static const guchar     Float32LE     = Float32 | LittleEndian;
       static const guchar     Float32BE     = Float32 | BigEndian;
       static const guchar     Float64LE     = Float64 | LittleEndian;
@@ -27,7 +27,6 @@
 #ifndef __file_dicom_element_h__
 #define __file_dicom_element_h__
 
-#include "hash_map.h"
 #include "file/mmap.h"
 #include "file/dicom/definitions.h"
 
@@ -57,8 +56,7 @@ namespace MR {
 
       class Element {
         protected:
-          static UnorderedMap<guint32, const gchar*>::Type dict;
-          static void           init_dict();
+          static const gchar*   dict_lookup (guint32 tag);
 
           File::MMap            fmap;
           void                  set_explicit_encoding();
@@ -151,8 +149,7 @@ namespace MR {
 
       inline String Element::tag_name() const
       {
-        if (dict.empty()) init_dict();
-        const gchar* s = dict[tag()];
+        const gchar* s = dict_lookup (tag());
         return (s ? s : "");
       }
 
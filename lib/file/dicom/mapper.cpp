@@ -36,6 +36,7 @@
 
 */
 
+#include "thread.h"
 #include "image/header.h"
 #include "image/mapper.h"
 #include "file/dicom/mapper.h"
@@ -61,6 +62,69 @@ namespace MR {
             ++current_axis;
           }
         }
+
+
+
+        // copies the frames into their final location in memory. Each thread
+        // keeps its current file mapped, since consecutive frames (e.g. the
+        // tiles of a mosaic) often come from the same file. Any messages are
+        // queued, to be displayed from the calling thread in frame order.
+        class FrameCopier {
+          public:
+            FrameCopier (const std::vector<Frame*>& frame_list, guint8* destination, guint row_bytes, guint row_stride_bytes) :
+              messages (NULL), frames (frame_list), mem (destination), row_size (row_bytes), row_stride (row_stride_bytes), 
+              frame_size (gsize (row_bytes) * frame_list[0]->dim[1]), failed (frame_list.size()), loop (frame_list.size(), 8) { }
+
+            void execute ()
+            {
+              File::MMap mmap;
+              gsize first, last;
+              while (loop.next (first, last)) {
+                for (gsize n = first; n < last; ++n) {
+                  messages->item (n);
+                  try {
+                    if (mmap.name() != frames[n]->filename) {
+                      mmap.init (frames[n]->filename);
+                      mmap.map();
+                    }
+                    const guint8* src = (guint8*) mmap.address() + frames[n]->data;
+                    guint8* dest = mem + n*frame_size;
+                    for (guint row = 0; row < frames[n]->dim[1]; ++row) {
+                      memcpy (dest, src, row_size);
+                      dest += row_size;
+                      src += row_stride;
+                    }
+                  }
+                  catch (Exception& E) {
+                    // the file may have failed to map, in which case the
+                    // next frame from it must try again rather than read
+                    // from a NULL address:
+                    mmap = File::MMap();
+                    Glib::Mutex::Lock lock (mutex);
+                    if (n < failed) {
+                      error = E.description;
+                      failed = n;
+                    }
+                  }
+                }
+                progress.inc (last - first);
+              }
+            }
+
+            Thread::Messages* messages;
+            String error;
+            Thread::Progress progress;
+
+          protected:
+            const std::vector<Frame*>& frames;
+            guint8* mem;
+            const guint row_size, row_stride;
+            const gsize frame_size;
+            gsize failed;
+            Thread::Loop loop;
+            Glib::Mutex mutex;
+        };
+
       }
 
 
@@ -273,23 +337,29 @@ namespace MR {
             throw Exception ("failed to allocate memory for image data!"); 
           }
 
-          guint8* dest = mem;
+          for (guint n = 1; n < frames.size(); ++n) {
+            if (frames[n]->dim[0] != frames[0]->dim[0] || frames[n]->dim[1] != frames[0]->dim[1]) {
+              delete [] mem;
+              throw Exception ("unable to load series due to inconsistent frame dimensions");
+            }
+          }
+
           const guint row_stride = nchannels * frames[0]->row_stride * (frames[0]->bits_alloc/8);
           const guint row_size = nchannels * frames[0]->dim[0] * (frames[0]->bits_alloc/8);
-          File::MMap mmap;
-          for (guint n = 0; n < frames.size(); ++n) {
-            mmap.init (frames[n]->filename);
-            mmap.map();
-            const guint8* src = (guint8*) mmap.address() + frames[n]->data;
-            for (guint row = 0; row < frames[n]->dim[1]; ++row) {
-              memcpy (dest, src, row_size);
-              dest += row_size;
-              src += row_stride;
-            }
-            ProgressBar::inc();
+          FrameCopier copier (frames, mem, row_size, row_stride);
+          {
+            Thread::Messages messages (frames.size());
+            copier.messages = &messages;
+            Thread::run (copier);
           }
+          copier.progress.update();
           ProgressBar::done();
 
+          if (copier.error.size()) {
+            delete [] mem;
+            throw Exception ("error reading DICOM image data: " + copier.error);
+          }
+
           dmap.add (mem);
 
         }
@@ -53,7 +53,6 @@ namespace MR {
         sequence.clear();
         series_number = bits_alloc = dim[0] = dim[1] = data = 0;
 
-        Exception::Lower l(2);
         Element item;
         try {
           item.set (filename); 
@@ -36,6 +36,11 @@ namespace MR {
       class QuickScan {
 
         public:
+          //! read the relevant fields from \a file_name, returning true on error
+          /*! Any Exception is caught, but will already have been displayed
+           * when constructed: callers should lower the log level using
+           * Exception::Lower beforehand if this is not wanted. This is not
+           * done here, since the log level is shared by all threads. */
           bool read (const String& file_name, bool print_DICOM_fields = false, bool print_CSA_fields = false);
 
           String      filename, modality;
@@ -0,0 +1,195 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <fstream>
+#include <glib/gstdio.h>
+#include <glibmm/fileutils.h>
+#include <glibmm/miscutils.h>
+
+#include "file/config.h"
+#include "file/dicom/scan_cache.h"
+
+#define SCAN_CACHE_MAGIC "mrtrix DICOM scan cache"
+
+namespace MR {
+  namespace File {
+    namespace Dicom {
+
+      namespace {
+
+        // tabs and newlines are used as delimiters in the cache file:
+        inline String sanitise (const String& text)
+        {
+          String s (text);
+          for (String::iterator c = s.begin(); c != s.end(); ++c)
+            if (*c == '\t' || *c == '\n' || *c == '\r') *c = ' ';
+          return (s);
+        }
+
+      }
+
+
+
+
+      ScanCache::ScanCache (const String& folder_name) : prefix (folder_name), modified (false)
+      {
+        if (!File::Config::get_bool ("DICOM.ScanCache", true)) return;
+
+        folder = Glib::path_is_absolute (folder_name) ? folder_name : Glib::build_filename (Glib::get_current_dir(), folder_name);
+        String cache_dir = Glib::build_filename (Glib::get_user_cache_dir(), "mrtrix");
+        cache_file = Glib::build_filename (cache_dir, "dicom-" + str (g_str_hash (folder.c_str())));
+
+        std::ifstream in (cache_file.c_str());
+        if (!in) return;
+
+        String line;
+        if (!getline (in, line) || line != SCAN_CACHE_MAGIC "\t" + folder) {
+          debug ("DICOM scan cache \"" + cache_file + "\" does not match folder \"" + folder + "\" - ignored");
+          return;
+        }
+
+        while (getline (in, line)) {
+          std::vector<String> V (split (line, "\t"));
+          if (V.size() != 21) continue;
+          try {
+            Entry& entry (entries[V[0]]);
+            entry.size = to<guint64> (V[1]);
+            entry.mtime = to<gint64> (V[2]);
+            entry.failed = to<int> (V[3]);
+            QuickScan& s (entry.scan);
+            s.modality = V[4];
+            s.patient = V[5];      s.patient_ID = V[6];   s.patient_DOB = V[7];
+            s.study = V[8];        s.study_ID = V[9];     s.study_date = V[10];  s.study_time = V[11];
+            s.series = V[12];      s.series_date = V[13]; s.series_time = V[14];
+            s.sequence = V[15];
+            s.series_number = to<guint> (V[16]);
+            s.bits_alloc = to<guint> (V[17]);
+            s.dim[0] = to<guint> (V[18]);
+            s.dim[1] = to<guint> (V[19]);
+            s.data = to<guint> (V[20]);
+          }
+          catch (...) { entries.erase (V[0]); }
+        }
+
+        debug ("loaded " + str (entries.size()) + " entries from DICOM scan cache \"" + cache_file + "\"");
+      }
+
+
+
+
+      String ScanCache::relative (const String& filename) const
+      {
+        if (filename.size() > prefix.size() && filename.compare (0, prefix.size(), prefix) == 0 && filename[prefix.size()] == G_DIR_SEPARATOR)
+          return (filename.substr (prefix.size()+1));
+        return (filename);
+      }
+
+
+
+
+      bool ScanCache::find (const String& filename, const struct stat& info, QuickScan& scan, bool& failed) const
+      {
+        if (cache_file.empty()) return (false);
+        std::map<String, Entry>::const_iterator entry = entries.find (relative (filename));
+        if (entry == entries.end()) return (false);
+        if (entry->second.size != guint64 (info.st_size) || entry->second.mtime != gint64 (info.st_mtime)) return (false);
+        entry->second.used = true;
+        scan = entry->second.scan;
+        scan.filename = filename;
+        failed = entry->second.failed;
+        return (true);
+      }
+
+
+
+
+      void ScanCache::add (const String& filename, const struct stat& info, const QuickScan& scan, bool failed)
+      {
+        if (cache_file.empty()) return;
+        Entry& entry (entries[relative (filename)]);
+        entry.size = info.st_size;
+        entry.mtime = info.st_mtime;
+        entry.failed = failed;
+        entry.used = true;
+        entry.scan = scan;
+        modified = true;
+      }
+
+
+
+
+      void ScanCache::save ()
+      {
+        if (cache_file.empty()) return;
+
+        for (std::map<String, Entry>::iterator entry = entries.begin(); entry != entries.end();) {
+          if (entry->second.used) ++entry;
+          else { entries.erase (entry++); modified = true; }
+        }
+        if (!modified) return;
+
+        String dir = Glib::path_get_dirname (cache_file);
+        if (g_mkdir_with_parents (dir.c_str(), 0755)) {
+          info ("unable to create folder \"" + dir + "\" for DICOM scan cache: " + Glib::strerror (errno));
+          return;
+        }
+
+        String tmpfile = cache_file + ".tmp";
+        {
+          std::ofstream out (tmpfile.c_str());
+          if (!out) {
+            info ("unable to write DICOM scan cache \"" + cache_file + "\": " + Glib::strerror (errno));
+            return;
+          }
+          out << SCAN_CACHE_MAGIC "\t" << folder << "\n";
+          for (std::map<String, Entry>::const_iterator entry = entries.begin(); entry != entries.end(); ++entry) {
+            const QuickScan& s (entry->second.scan);
+            out << sanitise (entry->first) << "\t" << entry->second.size << "\t" << entry->second.mtime << "\t" << int (entry->second.failed) << "\t"
+              << sanitise (s.modality) << "\t" 
+              << sanitise (s.patient) << "\t" << sanitise (s.patient_ID) << "\t" << sanitise (s.patient_DOB) << "\t" 
+              << sanitise (s.study) << "\t" << sanitise (s.study_ID) << "\t" << sanitise (s.study_date) << "\t" << sanitise (s.study_time) << "\t" 
+              << sanitise (s.series) << "\t" << sanitise (s.series_date) << "\t" << sanitise (s.series_time) << "\t" 
+              << sanitise (s.sequence) << "\t" 
+              << s.series_number << "\t" << s.bits_alloc << "\t" << s.dim[0] << "\t" << s.dim[1] << "\t" << s.data << "\n";
+          }
+          if (!out) {
+            info ("error writing DICOM scan cache \"" + cache_file + "\"");
+            out.close();
+            g_unlink (tmpfile.c_str());
+            return;
+          }
+        }
+
+        if (g_rename (tmpfile.c_str(), cache_file.c_str())) {
+          info ("error updating DICOM scan cache \"" + cache_file + "\": " + Glib::strerror (errno));
+          g_unlink (tmpfile.c_str());
+          return;
+        }
+
+        modified = false;
+        debug ("DICOM scan cache \"" + cache_file + "\" updated with " + str (entries.size()) + " entries");
+      }
+
+    }
+  }
+}
+
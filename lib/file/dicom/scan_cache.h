@@ -0,0 +1,77 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef __file_dicom_scan_cache_h__
+#define __file_dicom_scan_cache_h__
+
+#include <sys/stat.h>
+#include <map>
+#include "file/dicom/quick_scan.h"
+
+namespace MR {
+  namespace File {
+    namespace Dicom {
+
+      //! persistent store of QuickScan results for the files within a folder
+      /*! Entries are keyed by file name, and are only considered valid if the
+       * size and modification time of the file match those recorded. The
+       * cache for each folder is stored in the user's cache directory, and
+       * can be disabled by setting DICOM.ScanCache to false in the
+       * configuration file. */
+      class ScanCache {
+        public:
+          ScanCache (const String& folder_name);
+
+          //! retrieve the results for \a filename if they are still valid
+          /*! This can safely be called concurrently from multiple threads. */
+          bool find (const String& filename, const struct stat& info, QuickScan& scan, bool& failed) const;
+          //! record the results for \a filename 
+          void add (const String& filename, const struct stat& info, const QuickScan& scan, bool failed);
+          //! write the cache back to disk, if any entries have changed
+          /*! Only the entries that were either found or added since the cache
+           * was loaded are retained. */
+          void save ();
+
+        protected:
+          class Entry {
+            public:
+              Entry () : size (0), mtime (0), failed (true), used (false) { }
+              guint64   size;
+              gint64    mtime;
+              bool      failed;
+              mutable bool used;
+              QuickScan scan;
+          };
+
+          String prefix, folder, cache_file;
+          std::map<String, Entry> entries;
+          bool modified;
+
+          String relative (const String& filename) const;
+      };
+
+    }
+  }
+}
+
+#endif
+
@@ -20,6 +20,7 @@
 
 */
 
+#include "thread.h"
 #include "file/dicom/series.h"
 #include "file/dicom/study.h"
 #include "file/dicom/patient.h"
@@ -33,6 +34,66 @@ namespace MR {
 
 
 
+      namespace {
+
+        // reads the images concurrently. Any messages are queued, and only
+        // the Exception for the first image that failed is kept, so that
+        // these can be reported from the calling thread in image order.
+        class Reader {
+          public:
+            Reader (Series& series) : S (series), messages (NULL), failed (series.size()), loop (series.size()) { }
+
+            void execute ()
+            {
+              gsize first, last;
+              while (loop.next (first, last)) {
+                for (gsize n = first; n < last; n++) {
+                  messages->item (n);
+                  try { S[n]->read(); }
+                  catch (Exception& E) {
+                    Glib::Mutex::Lock lock (mutex);
+                    if (n < failed) {
+                      error = new Exception (E);
+                      failed = n;
+                    }
+                  }
+                }
+                progress.inc (last - first);
+              }
+            }
+
+            Series& S;
+            Thread::Messages* messages;
+            Ptr<Exception> error;
+            gsize failed;
+            Thread::Progress progress;
+
+          protected:
+            Thread::Loop loop;
+            Glib::Mutex mutex;
+        };
+
+      }
+
+
+
+      void Series::read ()
+      {
+        ProgressBar::init (size(), "reading DICOM series \"" + name + "\"...");
+        Reader reader (*this);
+        {
+          Thread::Messages messages (size());
+          reader.messages = &messages;
+          Thread::run (reader);
+        }
+        reader.progress.update();
+        ProgressBar::done();
+        // copied rather than constructed, since it was displayed when queued:
+        if (reader.error) throw Exception (*reader.error);
+      }
+
+
+
       std::vector<gint>  Series::count () const
       {
         std::vector<gint> dim (3);
@@ -88,20 +88,6 @@ namespace MR {
 
 
 
-      inline void Series::read ()
-      {
-        ProgressBar::init (size(), "reading DICOM series \"" + name + "\"...");
-        for (guint i = 0; i < size(); i++) {
-          (*this)[i]->read(); 
-          ProgressBar::inc();
-        }
-        ProgressBar::done();
-      }
-
-
-
-
-
     }
   }
 }
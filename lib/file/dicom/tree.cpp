@@ -30,12 +30,15 @@
 
 */
 
+#include <glib/gstdio.h>
 #include <glibmm/fileutils.h>
 #include <glibmm/stringutils.h>
 #include <glibmm/miscutils.h>
 
+#include "thread.h"
 #include "file/dicom/element.h"
 #include "file/dicom/quick_scan.h"
+#include "file/dicom/scan_cache.h"
 #include "file/dicom/image.h"
 #include "file/dicom/series.h"
 #include "file/dicom/study.h"
@@ -72,19 +75,62 @@ namespace MR {
 
 
 
-      void Tree::read_dir (const String& filename)
+      namespace {
+
+        // scans a list of files concurrently. Each file's results, and any
+        // messages issued while reading it, are stored in their own slot, so
+        // that the tree can then be built in the original order,
+        // independently of the number of threads used.
+        class Scanner {
+          public:
+            Scanner (const std::vector<String>& filenames, const ScanCache& scan_cache) :
+              files (filenames), cache (scan_cache), messages (NULL), scans (files.size()), info (files.size()),
+              failed (files.size(), 1), cached (files.size(), 0), loop (files.size(), 16) { }
+
+            void execute ()
+            {
+              gsize first, last;
+              while (loop.next (first, last)) {
+                for (gsize n = first; n < last; n++) {
+                  messages->item (n);
+                  if (g_stat (files[n].c_str(), &info[n])) continue;
+                  bool read_failed = true;
+                  if (cache.find (files[n], info[n], scans[n], read_failed)) cached[n] = 1;
+                  else read_failed = scans[n].read (files[n]);
+                  failed[n] = read_failed;
+                }
+                progress.inc (last - first);
+              }
+            }
+
+            const std::vector<String>& files;
+            const ScanCache& cache;
+            Thread::Messages* messages;
+            std::vector<QuickScan> scans;
+            std::vector<struct stat> info;
+            std::vector<guint8> failed, cached;
+            Thread::Progress progress;
+
+          protected:
+            Thread::Loop loop;
+        };
+
+      }
+
+
+
+
+
+
+      void Tree::read_dir (const String& filename, std::vector<String>& files)
       {
         try { 
           Glib::Dir folder (filename); 
           String entry;
           while ((entry = folder.read_name()).size()) {
             String name (Glib::build_filename (filename, entry));
-            if (Glib::file_test (name, Glib::FILE_TEST_IS_DIR)) read_dir (name);
-            else {
-              try { read_file (name); }
-              catch (Exception) { }
-            }
-            ProgressBar::inc();
+            if (Glib::file_test (name, Glib::FILE_TEST_IS_DIR)) read_dir (name, files);
+            else files.push_back (name);
           }
         }
         catch (...) { throw Exception ("error opening DICOM folder \"" + filename + "\": " + Glib::strerror (errno)); }
@@ -94,16 +140,60 @@ namespace MR {
 
 
 
+      void Tree::scan (const String& folder, const std::vector<String>& files)
+      {
+        ScanCache cache (folder);
+
+        // the log level is shared by all threads, so must only be lowered
+        // here, and the messages issued by the threads (including when
+        // exceptions are constructed) are displayed once they have completed:
+        Exception::Lower l (2);
+
+        Scanner scanner (files, cache);
+        {
+          Thread::Messages messages (files.size());
+          scanner.messages = &messages;
+          Thread::run (scanner);
+        }
+        scanner.progress.update();
+
+        guint ncached = 0;
+        for (guint n = 0; n < files.size(); n++) {
+          if (scanner.cached[n]) ncached++;
+          else if (scanner.info[n].st_mtime || scanner.info[n].st_size) 
+            cache.add (files[n], scanner.info[n], scanner.scans[n], scanner.failed[n]);
+
+          if (scanner.failed[n]) info ("error reading file \"" + files[n] + "\" - assuming not DICOM"); 
+          else add (scanner.scans[n]);
+        }
+
+        debug ("DICOM scan: " + str (ncached) + " of " + str (files.size()) + " files found in scan cache");
+        cache.save();
+      }
+
+
+
+
+
       void Tree::read_file (const String& filename)
       {
         QuickScan reader;
+        Exception::Lower l (2);
         if (reader.read (filename)) {
           info ("error reading file \"" + filename + "\" - assuming not DICOM"); 
           return;
         }
+        add (reader);
+      }
+
+
 
+
+
+      void Tree::add (const QuickScan& reader)
+      {
         if (! (reader.dim[0] && reader.dim[1] && reader.bits_alloc && reader.data)) {
-          info ("DICOM file \"" + filename + "\" does not seem to contain image data - ignored"); 
+          info ("DICOM file \"" + reader.filename + "\" does not seem to contain image data - ignored"); 
           return;
         }
 
@@ -112,7 +202,7 @@ namespace MR {
         RefPtr<Series> series = study->find (reader.series, reader.series_number, reader.modality, reader.series_date, reader.series_time);
 
         RefPtr<Image> image (new Image);
-        image->filename = filename;
+        image->filename = reader.filename;
         image->series = series.get();
         image->sequence_name = reader.sequence;
         series->push_back (image);
@@ -124,9 +214,14 @@ namespace MR {
 
       void Tree::read (const String& filename)
       {
-        ProgressBar::init (0, "scanning DICOM set \"" + shorten (filename) + "\"");
-        if (Glib::file_test (filename, Glib::FILE_TEST_IS_DIR)) read_dir (filename);
+        if (Glib::file_test (filename, Glib::FILE_TEST_IS_DIR)) {
+          std::vector<String> files;
+          read_dir (filename, files);
+          ProgressBar::init (files.size(), "scanning DICOM set \"" + shorten (filename) + "\"");
+          scan (filename, files);
+        }
         else {
+          ProgressBar::init (0, "scanning DICOM set \"" + shorten (filename) + "\"");
           try { read_file (filename); }
           catch (Exception) { }
         }
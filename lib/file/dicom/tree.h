@@ -32,11 +32,14 @@ namespace MR {
 
       class Series; 
       class Patient;
+      class QuickScan;
 
       class Tree : public std::vector< RefPtr<Patient> > { 
         protected:
-          void    read_dir (const String& filename);
+          void    read_dir (const String& filename, std::vector<String>& files);
           void    read_file (const String& filename);
+          void    scan (const String& folder, const std::vector<String>& files);
+          void    add (const QuickScan& reader);
          
         public:
           String    description;
@@ -0,0 +1,310 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <fcntl.h>
+#include <glib/gstdio.h>
+#include <glibmm/stringutils.h>
+
+#include "file/gz.h"
+#include "thread.h"
+
+#define GZ_BLOCK_SIZE (1U<<20)
+#define GZ_DICT_SIZE (1U<<15)
+#define GZ_MAX_READ (1U<<30)
+
+namespace MR {
+  namespace File {
+
+    namespace {
+
+      // compresses blocks of the input concurrently into raw deflate
+      // streams, terminated with a sync flush so that they can simply be
+      // concatenated, as done by pigz. Each block is primed with the 32 kB
+      // of input preceding it to minimise the loss of compression. Blocks are
+      // written out in order as soon as they are ready, and the number of
+      // blocks held in memory is bounded.
+      class Compressor {
+        public:
+          Compressor (FILE* file, int compression_level) :
+            out (file), level (compression_level), next (0), written (0), window (4*Thread::number()), crc (crc32 (0L, Z_NULL, 0)), total (0) { }
+
+          void add (const guint8* data, gsize size)
+          {
+            const guint8* start = data;
+            do {
+              Block block;
+              block.in = data;
+              block.size = MIN (size, gsize (GZ_BLOCK_SIZE));
+              block.dict_size = MIN (gsize (data - start), gsize (GZ_DICT_SIZE));
+              block.done = false;
+              blocks.push_back (block);
+              data += block.size;
+              size -= block.size;
+            } while (size);
+          }
+
+          void execute ()
+          {
+            while (true) {
+              gsize n;
+              {
+                Glib::Mutex::Lock lock (mutex);
+                while (next < blocks.size() && next >= written + window && error.empty()) space.wait (mutex);
+                if (next >= blocks.size() || error.size()) return;
+                n = next++;
+              }
+              compress (n);
+              flush();
+            }
+          }
+
+          void finish ()
+          {
+            if (error.size()) throw Exception (error);
+            guint8 trailer[8];
+            for (guint n = 0; n < 4; n++) {
+              trailer[n] = (crc >> (8*n)) & 0xFF;
+              trailer[n+4] = (total >> (8*n)) & 0xFF;
+            }
+            if (fwrite (trailer, 1, 8, out) != 8)
+              throw Exception ("error writing GZIP trailer: " + Glib::strerror (errno));
+          }
+
+        protected:
+          class Block {
+            public:
+              const guint8* in;
+              gsize size, dict_size;
+              std::vector<guint8> out;
+              uLong crc;
+              bool done;
+          };
+
+          FILE* out;
+          int level;
+          std::vector<Block> blocks;
+          gsize next, written, window;
+          uLong crc;
+          guint64 total;
+          String error;
+          Glib::Mutex mutex, write_mutex;
+          Glib::Cond space;
+
+          void compress (gsize n)
+          {
+            Block& block (blocks[n]);
+            bool last = ( n == blocks.size()-1 );
+            block.crc = crc32 (0L, block.in, block.size);
+
+            z_stream strm;
+            memset (&strm, 0, sizeof (z_stream));
+            if (deflateInit2 (&strm, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+              set_error ("error initialising GZIP compression");
+              return;
+            }
+            if (block.dict_size)
+              deflateSetDictionary (&strm, block.in - block.dict_size, block.dict_size);
+
+            block.out.resize (deflateBound (&strm, block.size) + 16);
+            strm.next_in = (Bytef*) block.in;
+            strm.avail_in = block.size;
+            strm.next_out = &block.out[0];
+            strm.avail_out = block.out.size();
+            int status = deflate (&strm, last ? Z_FINISH : Z_SYNC_FLUSH);
+            if (( last && status != Z_STREAM_END ) || ( !last && status != Z_OK ) || strm.avail_in)
+              set_error ("error compressing data");
+            block.out.resize (block.out.size() - strm.avail_out);
+            deflateEnd (&strm);
+
+            Glib::Mutex::Lock lock (mutex);
+            block.done = true;
+          }
+
+          void flush ()
+          {
+            Glib::Mutex::Lock wlock (write_mutex);
+            while (true) {
+              Block* block;
+              {
+                Glib::Mutex::Lock lock (mutex);
+                if (written >= blocks.size() || !blocks[written].done) return;
+                block = &blocks[written];
+              }
+
+              if (block->out.size() && fwrite (&block->out[0], 1, block->out.size(), out) != block->out.size())
+                set_error ("error writing compressed data: " + Glib::strerror (errno));
+              crc = crc32_combine (crc, block->crc, block->size);
+              total += block->size;
+              std::vector<guint8>().swap (block->out);
+
+              Glib::Mutex::Lock lock (mutex);
+              written++;
+              space.broadcast();
+            }
+          }
+
+          void set_error (const String& message)
+          {
+            Glib::Mutex::Lock lock (mutex);
+            if (error.empty()) error = message;
+            space.broadcast();
+          }
+      };
+
+    }
+
+
+
+
+    void GZ::open (const String& fname)
+    {
+      String error = try_open (fname);
+      if (error.size()) throw Exception (error);
+    }
+
+
+
+    void GZ::read (void* buffer, gsize size)
+    {
+      String error = try_read (buffer, size);
+      if (error.size()) throw Exception (error);
+    }
+
+
+
+    void GZ::skip (gsize size)
+    {
+      String error = try_skip (size);
+      if (error.size()) throw Exception (error);
+    }
+
+
+
+
+    String GZ::try_open (const String& fname)
+    {
+      close();
+      filename = fname;
+      gz = gzopen (filename.c_str(), "rb");
+      if (!gz) return ("error opening GZIP file \"" + filename + "\": " + Glib::strerror (errno));
+#if ZLIB_VERNUM >= 0x1240
+      gzbuffer (gz, 1<<17);
+#endif
+      return ("");
+    }
+
+
+
+    String GZ::try_read (void* buffer, gsize size)
+    {
+      guint8* p = (guint8*) buffer;
+      while (size) {
+        int n = gzread (gz, p, MIN (size, gsize (GZ_MAX_READ)));
+        if (n <= 0) return ("error uncompressing GZIP file \"" + filename + "\": "
+            + ( n ? String (gzerror (gz, &n)) : String ("unexpected end of file") ));
+        p += n;
+        size -= n;
+      }
+      return ("");
+    }
+
+
+
+    String GZ::try_skip (gsize size)
+    {
+      if (gzseek (gz, size, SEEK_CUR) < 0)
+        return ("error seeking in GZIP file \"" + filename + "\"");
+      return ("");
+    }
+
+
+
+    bool GZ::getline (String& line)
+    {
+      line.clear();
+      gchar buf[1024];
+      while (gzgets (gz, buf, sizeof (buf))) {
+        line += buf;
+        if (line.size() && line[line.size()-1] == '\n') break;
+      }
+      if (line.empty()) return (false);
+      while (line.size() && ( line[line.size()-1] == '\n' || line[line.size()-1] == 015 ))
+        line.resize (line.size()-1);
+      return (true);
+    }
+
+
+
+
+
+    void gzip (const String& gzfile, const guint8* header, gsize header_size, const guint8* data, gsize size, int level)
+    {
+      info ("writing compressed data to \"" +  gzfile + "\"...");
+
+      int fid = g_open (gzfile.c_str(), O_CREAT | O_RDWR | O_EXCL, 0755);
+      if (fid < 0) throw Exception ("error creating file \"" + gzfile + "\": " + Glib::strerror(errno));
+      FILE* out = fdopen (fid, "wb");
+      if (!out) {
+        close (fid);
+        throw Exception ("error opening GZIP file \"" + gzfile + "\" for writing");
+      }
+
+      std::vector<guint8> zeros;
+      if (!data && size) zeros.resize (MIN (size, gsize (GZ_BLOCK_SIZE)), 0);
+
+      try {
+        const guint8 gzheader[] = { 0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 3 };
+        if (fwrite (gzheader, 1, sizeof (gzheader), out) != sizeof (gzheader))
+          throw Exception ("error writing GZIP header: " + Glib::strerror (errno));
+
+        Compressor compressor (out, level);
+        if (header_size) compressor.add (header, header_size);
+        if (data) compressor.add (data, size);
+        else for (gsize n = 0; n < size; n += zeros.size())
+          compressor.add (&zeros[0], MIN (size-n, zeros.size()));
+        if (!header_size && !size) compressor.add (NULL, 0);
+
+        Thread::run (compressor);
+        compressor.finish();
+      }
+      // don't leave a truncated file behind:
+      catch (Exception& E) {
+        fclose (out);
+        g_unlink (gzfile.c_str());
+        throw Exception ("error writing GZIP file \"" + gzfile + "\": " + E.description);
+      }
+      catch (...) {
+        fclose (out);
+        g_unlink (gzfile.c_str());
+        throw Exception ("error writing GZIP file \"" + gzfile + "\"");
+      }
+
+      if (fclose (out)) {
+        String reason (Glib::strerror (errno));
+        g_unlink (gzfile.c_str());
+        throw Exception ("error closing GZIP file \"" + gzfile + "\": " + reason);
+      }
+    }
+
+  }
+}
+
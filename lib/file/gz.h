@@ -0,0 +1,80 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef __file_gz_h__
+#define __file_gz_h__
+
+#include <zlib.h>
+#include "mrtrix.h"
+
+namespace MR {
+  namespace File {
+
+    //! sequential read access to a GZIP-compressed file
+    /*! Data are only decompressed as far as they are requested, so that
+     * reading the header of a compressed image does not require the whole
+     * file to be decompressed. */
+    class GZ {
+      public:
+        GZ () : gz (NULL) { }
+        GZ (const String& fname) : gz (NULL) { open (fname); }
+        ~GZ () { close(); }
+
+        void          open (const String& fname);
+        void          close ()       { if (gz) { gzclose (gz); gz = NULL; } }
+        const String& name () const  { return (filename); }
+        bool          is_open () const { return (gz); }
+
+        //! read exactly \a size bytes into \a buffer
+        void          read (void* buffer, gsize size);
+        //! skip over the next \a size bytes
+        void          skip (gsize size);
+        //! as open(), read() and skip(), but return a description of any error rather than throwing an Exception
+        /*! These are intended for use from background threads, since an
+         * Exception is displayed as soon as it is constructed.
+         * \return an empty string on success. */
+        String        try_open (const String& fname);
+        String        try_read (void* buffer, gsize size);
+        String        try_skip (gsize size);
+
+        //! read the next line of text, stripped of its end-of-line characters
+        /*! \return false if the end of the file has been reached. */
+        bool          getline (String& line);
+
+      protected:
+        gzFile gz;
+        String filename;
+    };
+
+
+    //! write \a header followed by \a data to the GZIP file \a gzfile
+    /*! The data are split into blocks that are compressed concurrently, using
+     * the number of threads set by the NumberOfThreads config file entry. The
+     * output is a single valid GZIP stream. If \a data is NULL, \a size zero
+     * bytes are written. */
+    void gzip (const String& gzfile, const guint8* header, gsize header_size, const guint8* data, gsize size, int level = 6);
+
+  }
+}
+
+#endif
+
@@ -33,13 +33,16 @@ namespace MR {
       filename.clear();
       debug ("reading key/value file \"" + file + "\"...");
 
-      in.open (file.c_str(), std::ios::in | std::ios::binary);
-      if (!in) throw Exception ("failed to open key/value file \"" + file + "\": " + Glib::strerror(errno));
+      if (Glib::str_has_suffix (file, ".gz")) gz.open (file);
+      else {
+        in.open (file.c_str(), std::ios::in | std::ios::binary);
+        if (!in) throw Exception ("failed to open key/value file \"" + file + "\": " + Glib::strerror(errno));
+      }
       if (first_line) {
         String sbuf;
-        getline (in, sbuf);
+        read_line (sbuf);
         if (sbuf.compare (0, strlen (first_line), first_line)) {
-          in.close();
+          close();
           throw Exception ("invalid first line for key/value file \"" + file + "\" (expected \"" + first_line + "\")");
         }
       }
@@ -52,14 +55,11 @@ namespace MR {
 
     bool KeyValue::next ()
     {
-      while (in.good()) {
-        String sbuf;
-        getline (in, sbuf);
-        if (in.bad()) throw Exception ("error reading key/value file \"" + filename + "\": " + Glib::strerror (errno));
-
+      String sbuf;
+      while (read_line (sbuf)) {
         sbuf = strip (sbuf.substr (0, sbuf.find_first_of ('#')));
         if (sbuf == "END") {
-          in.setstate (std::ios::eofbit);
+          close();
           return (false);
         }
 
@@ -80,6 +80,18 @@ namespace MR {
 
 
 
+
+    bool KeyValue::read_line (String& line)
+    {
+      if (gz.is_open()) return (gz.getline (line));
+      if (!in.good()) return (false);
+      getline (in, line);
+      if (in.bad()) throw Exception ("error reading key/value file \"" + filename + "\": " + Glib::strerror (errno));
+      return (!in.fail() || line.size());
+    }
+
+
+
   }
 }
 
@@ -25,6 +25,7 @@
 
 #include <fstream>
 #include "mrtrix.h"
+#include "file/gz.h"
 
 namespace MR {
   namespace File {
@@ -36,7 +37,7 @@ namespace MR {
 
         void  open (const String& file, const gchar* first_line = NULL);
         bool  next ();
-        void  close () { in.close(); }
+        void  close () { in.close(); gz.close(); }
 
         const String& key () const throw ()   { return (K); }
         const String& value () const throw () { return (V); }
@@ -45,6 +46,9 @@ namespace MR {
       protected:
         String K, V, filename;
         std::ifstream in;
+        GZ gz;
+
+        bool  read_line (String& line);
     };
 
   }
@@ -26,6 +26,8 @@
 
 #include <glib/gstdio.h>
 #include <glibmm/stringutils.h>
+#include <glibmm/fileutils.h>
+#include <glibmm/miscutils.h>
 #include <fcntl.h>
 #include <unistd.h>
 
@@ -54,6 +56,19 @@ namespace MR {
         return (c+61);
       }
 
+
+      // scratch files are created in shared memory where available, so that
+      // images fed down a pipeline never need to be written out to disk:
+      String tmpfile_dir ()
+      {
+        String dir = Config::get ("TmpFileDir");
+        if (dir.size()) return (dir);
+#ifndef G_OS_WIN32
+        if (Glib::file_test ("/dev/shm", Glib::FILE_TEST_IS_DIR) && access ("/dev/shm", W_OK) == 0) return ("/dev/shm");
+#endif
+        return (".");
+      }
+
     }
 
     MMap::Base::~Base ()
@@ -86,6 +101,8 @@ namespace MR {
 #else 
         addr = (void *) mmap((char*)0, msize, (read_only ? PROT_READ : PROT_READ | PROT_WRITE), MAP_SHARED, fd, 0);
         if (addr == MAP_FAILED) throw 0;
+        if (sequential && madvise (addr, msize, MADV_SEQUENTIAL))
+          debug ("madvise failed for file \"" + filename + "\": " + Glib::strerror(errno));
 #endif
         debug ("file \"" + filename + "\" mapped at " + str (addr) 
             + ", size " + str (msize) 
@@ -221,17 +238,19 @@ namespace MR {
       debug ("creating and mapping scratch file");
 
       assert (suffix);
-      base->filename = String (TMPFILE_ROOT) + "XXXXXX." + suffix; 
+      String dir (tmpfile_dir());
+      String prefix (dir == "." ? String (TMPFILE_ROOT) : Glib::build_filename (dir, TMPFILE_ROOT));
+      base->filename = prefix + "XXXXXX." + suffix; 
 
       int fid;
       do {
         for (int n = 0; n < 6; n++) 
-          base->filename[TMPFILE_ROOT_LEN+n] = random_char();
+          base->filename[prefix.size()+n] = random_char();
           fid = g_open (base->filename.c_str(), O_CREAT | O_RDWR | O_EXCL, 0644);
       } while (fid < 0 && errno == EEXIST);
 
       if (fid < 0) 
-        throw Exception ("error creating temporary file in current working directory: " + Glib::strerror(errno));
+        throw Exception ("error creating temporary file in folder \"" + dir + "\": " + Glib::strerror(errno));
 
 
       int status = ftruncate (fid, desired_size_if_inexistant);
@@ -49,6 +49,11 @@ namespace MR {
 
         void              set_read_only (bool is_read_only);
         void              mark_for_deletion ()           { if (base) base->delete_after = true; }
+        //! hint that the mapping will be accessed in order, once
+        /*! This allows the system to read ahead aggressively, and to drop
+         * pages once they have been accessed. It takes effect the next time
+         * the file is mapped. */
+        void              set_sequential ()              { if (base) base->sequential = true; }
 
         bool              is_ready () const                  { return (base ? base->msize : false); }
         bool              is_mapped () const                 { return (base ? ( base->addr != NULL ) : false); }
@@ -68,7 +73,7 @@ namespace MR {
       private:
         class Base {
           private:
-            Base () : fd (-1), addr (NULL), msize (0), read_only (true), delete_after (false), mtime (0) { }
+            Base () : fd (-1), addr (NULL), msize (0), read_only (true), delete_after (false), sequential (false), mtime (0) { }
             ~Base ();
 
             int               fd;
@@ -77,6 +82,7 @@ namespace MR {
             gsize             msize;        /**< The size of the memory-mapping, should correspond to the size of the file. */
             bool              read_only;    /**< A flag to indicate whether the file is mapped as read-only. */
             bool              delete_after;
+            bool              sequential;
             time_t            mtime;
 
             void              map ();
@@ -81,6 +81,8 @@ namespace MR {
     inline gint32 BE (gint32 v)     { return (GINT32_TO_BE (v)); }
     inline guint32 LE (guint32 v)   { return (GUINT32_TO_LE (v)); }
     inline guint32 BE (guint32 v)   { return (GUINT32_TO_BE (v)); }
+    inline guint64 LE (guint64 v)   { return (GUINT64_TO_LE (v)); }
+    inline guint64 BE (guint64 v)   { return (GUINT64_TO_BE (v)); }
     inline float32 LE (float32 v)   { return (TO_LE (v)); }
     inline float32 BE (float32 v)   { return (TO_BE (v)); }
     inline float64 LE (float64 v)   { return (TO_LE (v)); }
@@ -88,6 +90,45 @@ namespace MR {
   }
 
 
+
+  //! convert a half-precision (IEEE 754 binary16) value to float32
+  inline float32 half_to_float (guint16 h)
+  {
+    union { guint32 i; float32 f; } v;
+    guint32 sign = guint32 (h & 0x8000U) << 16;
+    guint32 exponent = ( h >> 10 ) & 0x1FU;
+    guint32 mantissa = h & 0x03FFU;
+    if (exponent == 0x1FU) v.i = sign | 0x7F800000U | ( mantissa << 13 );
+    else if (exponent) v.i = sign | ( ( exponent + 112 ) << 23 ) | ( mantissa << 13 );
+    else { 
+      v.f = mantissa * 5.9604644775390625e-8f; // denormal: mantissa * 2^-24
+      v.i |= sign;
+    }
+    return (v.f);
+  }
+
+  //! convert a float32 value to half-precision, rounding to the nearest even value
+  /*! Values too large to be represented are converted to infinity. */
+  inline guint16 float_to_half (float32 f)
+  {
+    union { float32 f; guint32 i; } v = { f };
+    guint32 sign = ( v.i >> 16 ) & 0x8000U;
+    guint32 mag = v.i & 0x7FFFFFFFU;
+    if (mag >= 0x7F800000U) return (sign | 0x7C00U | ( mag > 0x7F800000U ? 0x0200U : 0 ));
+    if (mag >= 0x477FF000U) return (sign | 0x7C00U);
+    if (mag < 0x38800000U) { 
+      if (mag < 0x33000000U) return (sign);
+      guint32 shift = 126 - ( mag >> 23 );
+      guint32 m = ( mag & 0x007FFFFFU ) | 0x00800000U;
+      guint32 r = m >> shift, rem = m & ( ( 1U << shift ) - 1 ), half = 1U << ( shift - 1 );
+      if (rem > half || ( rem == half && ( r & 1U ) )) r++;
+      return (sign | r);
+    }
+    mag -= 0x38000000U;
+    return (sign | ( ( mag + 0x0FFFU + ( ( mag >> 13 ) & 1U ) ) >> 13 ));
+  }
+
+
   template <typename T> inline T getLE (const void* address) { return (ByteOrder::LE (*((T*) address))); }
   template <typename T> inline T getBE (const void* address) { return (ByteOrder::BE (*((T*) address))); }
   template <typename T> inline T get (const void* address, bool is_big_endian = MRTRIX_IS_BIG_ENDIAN)
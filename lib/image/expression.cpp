@@ -0,0 +1,497 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <cstdlib>
+
+#include "image/expression.h"
+#include "image/position.h"
+
+// the approximate number of voxels processed by each thread at a time:
+#define EXPRESSION_VOXELS 4096
+
+namespace MR {
+  namespace Image {
+
+    namespace {
+
+      enum OpType {
+        Input, Constant, If,
+        // unary operators:
+        Neg, Not, Abs, Sqrt, Exp, Log, Log10, Sin, Cos, Tan, Floor, Ceil, Round, IsNaN,
+        // binary operators:
+        Add, Sub, Mul, Div, Mod, Pow, LessThan, LessEqual, GreaterThan, GreaterEqual, Equal, NotEqual, And, Or, Min, Max
+      };
+
+      const gchar* unary_functions[] = { "abs", "sqrt", "exp", "log", "log10", "sin", "cos", "tan", "floor", "ceil", "round", "isnan", NULL };
+      const OpType unary_ops[] = { Abs, Sqrt, Exp, Log, Log10, Sin, Cos, Tan, Floor, Ceil, Round, IsNaN };
+
+      inline bool is_unary (int type) { return (type >= Neg && type < Add); }
+
+      inline float apply (int type, float a)
+      {
+        switch (type) {
+          case Neg:   return (-a);
+          case Not:   return (a == 0.0 ? 1.0 : 0.0);
+          case Abs:   return (fabsf (a));
+          case Sqrt:  return (sqrtf (a));
+          case Exp:   return (expf (a));
+          case Log:   return (logf (a));
+          case Log10: return (log10f (a));
+          case Sin:   return (sinf (a));
+          case Cos:   return (cosf (a));
+          case Tan:   return (tanf (a));
+          case Floor: return (floorf (a));
+          case Ceil:  return (ceilf (a));
+          case Round: return (roundf (a));
+          case IsNaN: return (gsl_isnan (a) ? 1.0 : 0.0);
+        }
+        assert (false);
+        return (GSL_NAN);
+      }
+
+      inline float apply (int type, float a, float b)
+      {
+        switch (type) {
+          case Add:          return (a + b);
+          case Sub:          return (a - b);
+          case Mul:          return (a * b);
+          case Div:          return (a / b);
+          case Mod:          return (fmodf (a, b));
+          case Pow:          return (powf (a, b));
+          case LessThan:     return (a < b ? 1.0 : 0.0);
+          case LessEqual:    return (a <= b ? 1.0 : 0.0);
+          case GreaterThan:  return (a > b ? 1.0 : 0.0);
+          case GreaterEqual: return (a >= b ? 1.0 : 0.0);
+          case Equal:        return (a == b ? 1.0 : 0.0);
+          case NotEqual:     return (a != b ? 1.0 : 0.0);
+          case And:          return (a != 0.0 && b != 0.0 ? 1.0 : 0.0);
+          case Or:           return (a != 0.0 || b != 0.0 ? 1.0 : 0.0);
+          case Min:          return (a < b ? a : b);
+          case Max:          return (a > b ? a : b);
+        }
+        assert (false);
+        return (GSL_NAN);
+      }
+
+
+
+
+      // The operation is selected once for each row, so that the loops over
+      // the voxels contain no branches and can be vectorised by the compiler:
+      template <int T> inline void unary_loop (float* r, const float* a, gsize n)
+      {
+        for (gsize i = 0; i < n; i++) r[i] = apply (T, a[i]);
+      }
+
+      template <int T> inline void binary_loop (float* r, const float* a, const float* b, gsize n)
+      {
+        for (gsize i = 0; i < n; i++) r[i] = apply (T, a[i], b[i]);
+      }
+
+      template <int T> inline void binary_loop (float* r, const float* a, float b, gsize n)
+      {
+        for (gsize i = 0; i < n; i++) r[i] = apply (T, a[i], b);
+      }
+
+#define EXPRESSION_CASE(type, loop, ...) case type: loop<type> (__VA_ARGS__); return;
+
+      void unary (int type, float* r, const float* a, gsize n)
+      {
+        switch (type) {
+          EXPRESSION_CASE (Neg, unary_loop, r, a, n);
+          EXPRESSION_CASE (Not, unary_loop, r, a, n);
+          EXPRESSION_CASE (Abs, unary_loop, r, a, n);
+          EXPRESSION_CASE (Sqrt, unary_loop, r, a, n);
+          EXPRESSION_CASE (Exp, unary_loop, r, a, n);
+          EXPRESSION_CASE (Log, unary_loop, r, a, n);
+          EXPRESSION_CASE (Log10, unary_loop, r, a, n);
+          EXPRESSION_CASE (Sin, unary_loop, r, a, n);
+          EXPRESSION_CASE (Cos, unary_loop, r, a, n);
+          EXPRESSION_CASE (Tan, unary_loop, r, a, n);
+          EXPRESSION_CASE (Floor, unary_loop, r, a, n);
+          EXPRESSION_CASE (Ceil, unary_loop, r, a, n);
+          EXPRESSION_CASE (Round, unary_loop, r, a, n);
+          EXPRESSION_CASE (IsNaN, unary_loop, r, a, n);
+        }
+        assert (false);
+      }
+
+      template <typename B> void binary (int type, float* r, const float* a, B b, gsize n)
+      {
+        switch (type) {
+          EXPRESSION_CASE (Add, binary_loop, r, a, b, n);
+          EXPRESSION_CASE (Sub, binary_loop, r, a, b, n);
+          EXPRESSION_CASE (Mul, binary_loop, r, a, b, n);
+          EXPRESSION_CASE (Div, binary_loop, r, a, b, n);
+          EXPRESSION_CASE (Mod, binary_loop, r, a, b, n);
+          EXPRESSION_CASE (Pow, binary_loop, r, a, b, n);
+          EXPRESSION_CASE (LessThan, binary_loop, r, a, b, n);
+          EXPRESSION_CASE (LessEqual, binary_loop, r, a, b, n);
+          EXPRESSION_CASE (GreaterThan, binary_loop, r, a, b, n);
+          EXPRESSION_CASE (GreaterEqual, binary_loop, r, a, b, n);
+          EXPRESSION_CASE (Equal, binary_loop, r, a, b, n);
+          EXPRESSION_CASE (NotEqual, binary_loop, r, a, b, n);
+          EXPRESSION_CASE (And, binary_loop, r, a, b, n);
+          EXPRESSION_CASE (Or, binary_loop, r, a, b, n);
+          EXPRESSION_CASE (Min, binary_loop, r, a, b, n);
+          EXPRESSION_CASE (Max, binary_loop, r, a, b, n);
+        }
+        assert (false);
+      }
+
+#undef EXPRESSION_CASE
+
+    }
+
+
+
+
+
+    class Expression::Parser {
+      public:
+        Parser (Expression& expression, const String& text) : E (expression), s (text), pos (0) { }
+
+        void parse () 
+        {
+          logical_or();
+          skip_space();
+          if (pos < s.size()) 
+            error ("unexpected character '" + s.substr (pos, 1) + "'");
+        }
+
+      protected:
+        Expression& E;
+        const String& s;
+        String::size_type pos;
+
+        void error (const String& message) const
+        {
+          throw Exception ("error parsing expression \"" + s + "\": " + message);
+        }
+
+        void skip_space () { while (pos < s.size() && g_ascii_isspace (s[pos])) pos++; }
+
+        // consume the token if it is next in the string:
+        bool match (const gchar* token)
+        {
+          skip_space();
+          const String::size_type len = strlen (token);
+          if (s.compare (pos, len, token)) return (false);
+          // don't mistake "<=" for "<", or "&&" for "&", etc:
+          if (len == 1 && pos+1 < s.size() && s[pos+1] == '=' && strchr ("<>=!", token[0])) return (false);
+          pos += len;
+          return (true);
+        }
+
+        void expect (const gchar* token) { if (!match (token)) error (String ("expected '") + token + "'"); }
+
+        void emit (int type)
+        {
+          std::vector<Op>& P (E.program);
+          Op op (type);
+          if (type == If || P.back().type != Constant) { P.push_back (op); return; }
+
+          // fold constant operands into the operation:
+          if (is_unary (type)) P.back().value = apply (type, P.back().value);
+          else if (P.size() > 1 && P[P.size()-2].type == Constant) {
+            P[P.size()-2].value = apply (type, P[P.size()-2].value, P.back().value);
+            P.pop_back();
+          }
+          else {
+            op.scalar = true;
+            op.value = P.back().value;
+            P.back() = op;
+          }
+        }
+
+        void logical_or ()
+        {
+          logical_and();
+          while (match ("||")) { logical_and(); emit (Or); }
+        }
+
+        void logical_and ()
+        {
+          comparison();
+          while (match ("&&")) { comparison(); emit (And); }
+        }
+
+        void comparison ()
+        {
+          sum();
+          while (true) {
+            if (match ("<=")) { sum(); emit (LessEqual); }
+            else if (match (">=")) { sum(); emit (GreaterEqual); }
+            else if (match ("==")) { sum(); emit (Equal); }
+            else if (match ("!=")) { sum(); emit (NotEqual); }
+            else if (match ("<")) { sum(); emit (LessThan); }
+            else if (match (">")) { sum(); emit (GreaterThan); }
+            else return;
+          }
+        }
+
+        void sum ()
+        {
+          product();
+          while (true) {
+            if (match ("+")) { product(); emit (Add); }
+            else if (match ("-")) { product(); emit (Sub); }
+            else return;
+          }
+        }
+
+        void product ()
+        {
+          unary();
+          while (true) {
+            if (match ("*")) { unary(); emit (Mul); }
+            else if (match ("/")) { unary(); emit (Div); }
+            else if (match ("%")) { unary(); emit (Mod); }
+            else return;
+          }
+        }
+
+        void unary ()
+        {
+          if (match ("-")) { unary(); emit (Neg); }
+          else if (match ("!")) { unary(); emit (Not); }
+          else if (match ("+")) unary();
+          else power();
+        }
+
+        void power ()
+        {
+          primary();
+          if (match ("^")) { unary(); emit (Pow); }
+        }
+
+        void primary ()
+        {
+          skip_space();
+          if (pos >= s.size()) error ("unexpected end of expression");
+
+          if (match ("(")) {
+            logical_or();
+            expect (")");
+            return;
+          }
+
+          if (g_ascii_isdigit (s[pos]) || s[pos] == '.') {
+            const gchar* start = s.c_str() + pos;
+            gchar* end;
+            float value = strtod (start, &end);
+            if (end == start) error ("invalid number");
+            pos += end - start;
+            E.program.push_back (Op (Constant, value));
+            return;
+          }
+
+          if (!g_ascii_isalpha (s[pos])) 
+            error ("unexpected character '" + s.substr (pos, 1) + "'");
+
+          String::size_type start = pos;
+          while (pos < s.size() && ( g_ascii_isalnum (s[pos]) || s[pos] == '_' )) pos++;
+          String name (s.substr (start, pos-start));
+
+          if (name == "pi") { E.program.push_back (Op (Constant, M_PI)); return; }
+          if (name == "inf") { E.program.push_back (Op (Constant, GSL_POSINF)); return; }
+          if (name == "nan") { E.program.push_back (Op (Constant, GSL_NAN)); return; }
+
+          if (name.size() == 1) {
+            int index = g_ascii_tolower (name[0]) - 'a';
+            E.program.push_back (Op (Input, 0.0, index));
+            if (guint (index) >= E.ninputs) E.ninputs = index+1;
+            return;
+          }
+
+          expect ("(");
+          for (int n = 0; unary_functions[n]; n++) {
+            if (name == unary_functions[n]) {
+              logical_or();
+              expect (")");
+              emit (unary_ops[n]);
+              return;
+            }
+          }
+
+          if (name == "min" || name == "max") {
+            logical_or(); expect (",");
+            logical_or(); expect (")");
+            emit (name == "min" ? Min : Max);
+            return;
+          }
+
+          if (name == "if") {
+            logical_or(); expect (",");
+            logical_or(); expect (",");
+            logical_or(); expect (")");
+            emit (If);
+            return;
+          }
+
+          error ("unknown function \"" + name + "\"");
+        }
+    };
+
+
+
+
+
+    Expression::Expression (const String& expression) : ninputs (0), depth (0), in_objs (NULL), out_obj (NULL)
+    {
+      Parser (*this, expression).parse();
+
+      // find the number of row buffers needed:
+      guint size = 0;
+      for (guint n = 0; n < program.size(); n++) {
+        if (program[n].type == Input || program[n].type == Constant) size++;
+        else if (program[n].type == If) size -= 2;
+        else if (!is_unary (program[n].type) && !program[n].scalar) size--;
+        if (size > depth) depth = size;
+      }
+      assert (size == 1);
+    }
+
+
+
+
+
+    void Expression::evaluate (const std::vector<const float*>& inputs, float* output, gsize count, std::vector<float>& workspace) const
+    {
+      if (workspace.size() < depth*count) workspace.resize (depth*count);
+      std::vector<const float*> arg (depth);
+      guint sp = 0;
+
+      for (guint n = 0; n < program.size(); n++) {
+        const Op& op (program[n]);
+
+        if (op.type == Input) { arg[sp++] = inputs[op.index]; continue; }
+
+        if (op.type == Constant) {
+          float* r = &workspace[sp*count];
+          for (gsize i = 0; i < count; i++) r[i] = op.value;
+          arg[sp++] = r;
+          continue;
+        }
+
+        // pop the operands first, so that the result of the operation is
+        // always held in the buffer for its position on the stack:
+        if (op.type == If) sp -= 2;
+        else if (!is_unary (op.type) && !op.scalar) sp--;
+        float* r = &workspace[(sp-1)*count];
+
+        if (op.type == If) {
+          const float* c = arg[sp-1], *a = arg[sp], *b = arg[sp+1];
+          for (gsize i = 0; i < count; i++) r[i] = c[i] != 0.0 ? a[i] : b[i];
+        }
+        else if (is_unary (op.type)) unary (op.type, r, arg[sp-1], count);
+        else if (op.scalar) binary (op.type, r, arg[sp-1], op.value, count);
+        else binary (op.type, r, arg[sp-1], arg[sp], count);
+
+        arg[sp-1] = r;
+      }
+
+      memcpy (output, arg[0], count*sizeof (float));
+    }
+
+
+
+
+
+    void Expression::run (std::vector<RefPtr<Object> >& inputs, Object& output, const String& message)
+    {
+      if (inputs.size() != ninputs)
+        throw Exception ("expression refers to " + str(ninputs) + " images, but " + str(inputs.size()) + " were supplied");
+
+      for (guint i = 0; i < inputs.size(); i++) {
+        if (inputs[i]->is_complex())
+          throw Exception ("complex image \"" + inputs[i]->name() + "\" is not supported");
+        for (int n = 0; n < inputs[i]->ndim(); n++) {
+          if (inputs[i]->dim(n) > 1 && ( n >= output.ndim() || inputs[i]->dim(n) != output.dim(n) ))
+            throw Exception ("dimensions of image \"" + inputs[i]->name() + "\" do not match those of output image \"" + output.name() + "\"");
+        }
+        inputs[i]->map();
+      }
+      output.map();
+
+      in_objs = &inputs;
+      out_obj = &output;
+
+      gsize num_rows = output.voxel_count() / output.dim(0);
+      loop = new Thread::Loop (num_rows, MAX (1, EXPRESSION_VOXELS / output.dim(0)));
+
+      ProgressBar::init (num_rows, message);
+      Thread::run (*this, output.data_type() == DataType::Bit ? 1 : Thread::number());
+      progress.update();
+      ProgressBar::done();
+
+      in_objs = NULL;
+      out_obj = NULL;
+    }
+
+
+
+
+
+    void Expression::execute ()
+    {
+      std::vector<RefPtr<Position> > in (in_objs->size());
+      for (guint i = 0; i < in.size(); i++) 
+        in[i] = new Position (*(*in_objs)[i]);
+      Position out (*out_obj);
+
+      const int nx = out.dim(0);
+      std::vector<float> values (in.size()*nx), result (nx), workspace;
+      std::vector<const float*> rows (in.size());
+      for (guint i = 0; i < in.size(); i++)
+        rows[i] = &values[i*nx];
+
+      gsize first, last;
+      while (loop->next (first, last)) {
+        for (gsize row = first; row < last; row++) {
+          gsize r = row;
+          for (int n = 1; n < out.ndim(); n++) {
+            out.set (n, r % out.dim(n));
+            r /= out.dim(n);
+          }
+
+          for (guint i = 0; i < in.size(); i++) {
+            Position& pos (*in[i]);
+            for (int n = 1; n < pos.ndim(); n++)
+              pos.set (n, pos.dim(n) > 1 ? out[n] : 0);
+            float* v = &values[i*nx];
+            if (pos.dim(0) > 1) pos.get_row (v, nx);
+            else {
+              const float val = pos.value();
+              for (int x = 0; x < nx; x++) v[x] = val;
+            }
+          }
+
+          evaluate (rows, &result[0], nx, workspace);
+          out.set_row (&result[0], nx);
+        }
+        progress.inc (last - first);
+      }
+    }
+
+  }
+}
@@ -0,0 +1,106 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef __image_expression_h__
+#define __image_expression_h__
+
+#include "ptr.h"
+#include "thread.h"
+#include "image/object.h"
+
+namespace MR {
+  namespace Image {
+
+    //! evaluate an arithmetic expression at each voxel of a set of images
+    /*! The expression is parsed once on construction, and compiled into a
+     * short program that is then applied to whole rows of voxels at a time,
+     * one operation after the other. The intermediate values for each row
+     * are held in small buffers that remain in cache, so that an expression
+     * involving several images and operations is evaluated in a single pass
+     * over the data, without creating any intermediate images.
+     *
+     * Images are referred to by a single letter, in the order they are
+     * supplied: \c a for the first image, \c b for the second, etc. The
+     * following are supported, in increasing order of precedence:
+     * - the logical operators \c || and \c &&
+     * - the comparison operators \c <, \c <=, \c >, \c >=, \c == and \c !=
+     * - the binary operators \c + and \c -
+     * - the binary operators \c *, \c / and \c %
+     * - the unary operators \c - and \c !
+     * - the power operator \c ^ (right-associative)
+     * - numbers, the constants \c pi, \c inf and \c nan, parentheses, and
+     * the functions \c abs, \c sqrt, \c exp, \c log, \c log10, \c sin,
+     * \c cos, \c tan, \c floor, \c ceil, \c round, \c isnan, \c min,
+     * \c max and \c if (i.e. \c if(cond,a,b)).
+     *
+     * Logical and comparison operators evaluate to 1 if true and 0 if false,
+     * and treat any non-zero value as true. */
+    class Expression {
+      public:
+        //! parse \a expression, throwing an Exception if it is invalid
+        Expression (const String& expression);
+
+        //! the number of input images referred to in the expression
+        /*! This is one more than the index of the last image referred to. */
+        guint num_inputs () const { return (ninputs); }
+
+        //! evaluate the expression for \a count voxels
+        /*! The values of each input image are read from \a inputs, and the
+         * results are written to \a output. The \a workspace is resized as
+         * required, and can be reused between calls. */
+        void evaluate (const std::vector<const float*>& inputs, float* output, gsize count, std::vector<float>& workspace) const;
+
+        //! evaluate the expression at each voxel of \a output
+        /*! Any input image whose dimension along an axis is 1 has its
+         * values repeated along that axis as required; otherwise, the
+         * dimensions must match those of \a output. The rows of the images
+         * are processed concurrently by Thread::number() threads (or a
+         * single thread for bitwise output). */
+        void run (std::vector<RefPtr<Object> >& inputs, Object& output, const String& message);
+
+        void execute ();
+
+      protected:
+        class Op {
+          public:
+            Op (int op_type, float constant = 0.0, int input_index = 0) : type (op_type), index (input_index), value (constant), scalar (false) { }
+            int type, index;
+            float value;
+            bool scalar;
+        };
+
+        std::vector<Op> program;
+        guint ninputs, depth;
+
+        std::vector<RefPtr<Object> >* in_objs;
+        Object* out_obj;
+        Ptr<Thread::Loop> loop;
+        Thread::Progress progress;
+
+        class Parser;
+    };
+
+  }
+}
+
+#endif
+
@@ -20,26 +20,125 @@
 
 */
 
+#include "thread.h"
 #include "math/fft.h"
 #include "image/fft.h"
 #include "image/position.h"
 
+// the approximate number of voxels transformed by each thread at a time:
+#define FFT_BATCH_VOXELS 16384
+
 namespace MR {
   namespace Image {
 
-
     namespace {
-      inline bool next (Position& pos, const int limits[MRTRIX_MAX_NDIMS])
+
+      inline bool is_double (const DataType& dt) 
       {
-        int axis = 0;
-        do {
-          pos.inc (axis);
-          if (pos[axis] < limits[axis]) return (true);
-          pos.set (axis, 0);
-          axis++;
-        } while (axis < pos.ndim());
-        return (false);
+        return (dt.bits() == ( dt.is_complex() ? 128 : 64 ));
       }
+
+
+
+      template <typename T> class LineTransform {
+        public:
+          LineTransform (Object& destination, Object& source_image, int transform_axis, bool inverse_transform, bool shift_centre) :
+            dest (destination), source (source_image), axis (transform_axis),
+            length (source_image.dim (transform_axis)),
+            batch (MAX (1, FFT_BATCH_VOXELS / length)),
+            inverse (inverse_transform), shift (shift_centre), 
+            real (!source_image.is_complex() && !inverse_transform),
+            loop (source_image.voxel_count() / length, batch) { }
+
+          void execute ()
+          {
+            Position src (source), dst (dest);
+            Math::FFT ft;
+            std::vector<Math::ComplexNumber<T> > buffer (batch * length);
+            const int shift_dist = (length+1)/2, shift_up = length/2;
+            gsize first, last;
+
+            while (loop.next (first, last)) {
+              for (gsize line = first; line < last; line++) {
+                set_line (src, line);
+                Math::ComplexNumber<T>* data = &buffer[(line-first)*length];
+                for (int n = 0; n < length; n++) {
+                  src.set (axis, shift && inverse ? ( n >= shift_dist ? n - shift_dist : n + shift_up ) : n);
+                  data[n].re() = src.re();
+                  data[n].im() = src.is_complex() ? src.im() : 0.0;
+                }
+              }
+
+              if (real) ft.real_fft (&buffer[0], length, last - first);
+              else ft.fft (&buffer[0], length, last - first, inverse);
+
+              for (gsize line = first; line < last; line++) {
+                set_line (dst, line);
+                const Math::ComplexNumber<T>* data = &buffer[(line-first)*length];
+                for (int n = 0; n < length; n++) {
+                  dst.set (axis, shift && !inverse ? ( n >= shift_dist ? n - shift_dist : n + shift_up ) : n);
+                  if (dst.is_complex()) {
+                    dst.re (data[n].re());
+                    dst.im (data[n].im());
+                  }
+                  else dst.value (sqrt (data[n].re()*data[n].re() + data[n].im()*data[n].im()));
+                }
+              }
+
+              progress.inc (last - first);
+            }
+          }
+
+          void run (const String& message)
+          {
+            ProgressBar::init (loop.size(), message);
+            Thread::run (*this);
+            progress.update();
+            ProgressBar::done();
+          }
+
+        protected:
+          Object& dest;
+          Object& source;
+          const int axis, length, batch;
+          const bool inverse, shift, real;
+          Thread::Loop loop;
+          Thread::Progress progress;
+
+          void set_line (Position& pos, gsize line) const
+          {
+            for (int n = 0; n < pos.ndim(); n++) {
+              if (n == axis) continue;
+              pos.set (n, line % pos.dim(n));
+              line /= pos.dim(n);
+            }
+          }
+      };
+
+
+
+      void transform (Object& dest, Object& source, int axis, bool inverse, bool shift)
+      {
+        if (axis < 0 || axis >= source.ndim())
+          throw Exception ("invalid axis " + str(axis) + " for FFT of image \"" + source.name() + "\"");
+        if (dest.ndim() != source.ndim())
+          throw Exception ("dimensions of images \"" + source.name() + "\" and \"" + dest.name() + "\" do not match");
+        for (int n = 0; n < source.ndim(); n++) 
+          if (dest.dim(n) != source.dim(n))
+            throw Exception ("dimensions of images \"" + source.name() + "\" and \"" + dest.name() + "\" do not match");
+
+        source.map();
+        dest.map();
+
+        String message = String ("performing ") + ( shift ? "shifted " : "" ) +  ( inverse ? "inverse " : "" ) 
+          + "FFT along axis " + str (axis) +"...";
+
+        if (is_double (source.data_type()) || is_double (dest.data_type())) 
+          LineTransform<double> (dest, source, axis, inverse, shift).run (message);
+        else 
+          LineTransform<float> (dest, source, axis, inverse, shift).run (message);
+      }
+
     }
 
 
@@ -47,48 +146,34 @@ namespace MR {
 
     void FFT::fft (Position& dest, Position& source, int axis, bool inverse, bool shift)
     {
-      int shift_dist = (source.dim(axis)+1)/2;
-      int shift_up   = source.dim(axis)/2;
+      transform (dest.image, source.image, axis, inverse, shift);
+    }
 
-      std::vector<Math::ComplexNumber<double> > array (source.dim (axis));
 
-      guint count = 1;
-      int limits[MRTRIX_MAX_NDIMS];
-      for (int n = 0; n < source.ndim(); n++) {
-        if (n == axis) limits[n] = 1;
-        else { limits[n] = source.dim(n); count *= limits[n]; }
-      }
 
-      ProgressBar::init (count, String ("performing ") + ( shift ? "shifted " : "" ) +  ( inverse ? "inverse " : "" ) 
-          + "FFT along axis " + str (axis) +"...");
-
-      do {
-        for (int n = 0; n < source.dim(axis); n++) {
-          if (shift && inverse) source.set (axis, ( n >= shift_dist ? n - shift_dist : n + shift_up ));
-          else source.set (axis, n);
-          array[n].re() = source.re();
-          array[n].im() = source.im();
-        }
-
-        ft.fft (array, inverse);
-
-        for (int n = 0; n < source.dim(axis); n++) {
-          if (shift && !inverse) dest.set (axis, ( n >= shift_dist ? n - shift_dist : n + shift_up ));
-          else dest.set (axis, n);
-          if (dest.is_complex()) {
-            dest.re(array[n].re());
-            dest.im(array[n].im());
-          }
-          else dest.value (sqrt(array[n].re()*array[n].re() + array[n].im()*array[n].im()));
-        }
 
-        ProgressBar::inc();  
-      } while (next (source, limits));
+    void FFT::fft (Position& dest, Position& source, const std::vector<int>& axes, bool inverse, bool shift)
+    {
+      if (axes.empty()) return;
+
+      // the intermediate results must be stored as complex values:
+      RefPtr<Object> temp;
+      Object* intermediate = &dest.image;
+      if (axes.size() > 1 && !dest.is_complex()) {
+        Header header (dest.image.header());
+        header.data_type = is_double (dest.image.data_type()) ? DataType::CFloat64 : DataType::CFloat32;
+        header.offset = 0.0;
+        header.scale = 1.0;
+        temp = new Object;
+        temp->create ("", header);
+        intermediate = temp.get();
+      }
 
-      ProgressBar::done();
+      transform (axes.size() > 1 ? *intermediate : dest.image, source.image, axes[0], inverse, shift);
+      for (guint n = 1; n < axes.size(); n++)
+        transform (n < axes.size()-1 ? *intermediate : dest.image, *intermediate, axes[n], inverse, shift);
     }
 
   }
 }
 
-
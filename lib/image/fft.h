@@ -23,18 +23,33 @@
 #ifndef __image_fft_h__
 #define __image_fft_h__
 
-#include "math/fft.h"
+#include "mrtrix.h"
 
 namespace MR {
   namespace Image {
 
     class Position;
 
+    //! compute the FFT of an image along one or more axes
+    /*! The lines of the image along each axis are transformed in batches,
+     * gathered into contiguous buffers, and processed concurrently by
+     * Thread::number() threads. The transform is performed in double
+     * precision if either image is stored as 64-bit floating-point, and in
+     * single precision otherwise. The forward transform of real-valued
+     * images exploits the symmetry of the result to halve the work.
+     *
+     * If \a shift is set, the zero frequency is moved to the centre of each
+     * axis (or back again for the inverse transform). If \a dest is not
+     * complex, the magnitude of the transform is stored. */
     class FFT {
-      protected:
-        Math::FFT  ft;
       public:
+        //! transform \a source along \a axis, storing the result in \a dest
         void fft (Position& dest, Position& source, int axis, bool inverse = false, bool shift = false);
+
+        //! transform \a source along each of \a axes in turn, storing the result in \a dest
+        /*! If \a dest is not complex, a temporary complex image is used to
+         * hold the intermediate results. */
+        void fft (Position& dest, Position& source, const std::vector<int>& axes, bool inverse = false, bool shift = false);
     };
 
   }
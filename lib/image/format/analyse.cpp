@@ -310,6 +310,12 @@ namespace MR {
             H.data_type = DataType::CFloat32; 
             info ("WARNING: changing data type to CFloat32 for image \"" + H.name + "\" to ensure compatibility with Analyse");
             break;
+          case DataType::Float16:
+          case DataType::Float16LE:
+          case DataType::Float16BE: 
+            H.data_type = DataType::Float32; 
+            info ("WARNING: changing data type to Float32 for image \"" + H.name + "\" to ensure compatibility with Analyse");
+            break;
         }
 
         return (true);
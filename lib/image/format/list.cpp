@@ -34,6 +34,7 @@ namespace MR {
       new Format::Analyse,
       new Format::XDS,
       new Format::DICOM,
+      new Format::MRtrixSparse,
       NULL
     };
 
@@ -42,6 +43,7 @@ namespace MR {
       ".mih",
       ".mif",
       ".mif.gz",
+      ".msf",
       ".img",
       ".nii",
       ".nii.gz",
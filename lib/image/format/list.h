@@ -23,6 +23,7 @@
 #ifndef __image_format_list_h__
 #define __image_format_list_h__
 
+#include <map>
 #include "image/format/base.h"
 
 #define DECLARE_IMAGEFORMAT(format) \
@@ -37,6 +38,7 @@
 
 
 namespace MR {
+  namespace File { class KeyValue; }
   namespace Image {
     namespace Format {
 
@@ -46,6 +48,23 @@ namespace MR {
       DECLARE_IMAGEFORMAT (XDS);
       DECLARE_IMAGEFORMAT (MRtrix);
       DECLARE_IMAGEFORMAT (DICOM);
+      DECLARE_IMAGEFORMAT (MRtrixSparse);
+
+      //! write the entries of a MRtrix-style text header describing \a H
+      /*! This does not include the identification line, the "file" entry or
+       * the terminating "END" line, which depend on the format. */
+      void write_MRtrix_header (std::ostream& out, const Header& H);
+
+      //! parse the entries of a MRtrix-style text header into \a H
+      /*! Any entries not describing the image itself (e.g. "file") are
+       * returned in \a other, indexed by their lowercase key. */
+      void read_MRtrix_header (File::KeyValue& kv, Header& H, std::map<String,String>& other);
+
+      //! write a MRtrix header (.mih) for data stored in an existing file
+      /*! The data for the image described by \a H (using its data type and
+       * layout) are stored in \a data_file, starting \a offset bytes into
+       * the file. */
+      void create_MRtrix_header (const String& header_name, const Header& H, const String& data_file, gsize offset);
 
     }
   }
@@ -25,12 +25,12 @@
 */
 
 #include <unistd.h>
-#include <zlib.h>
 #include <fcntl.h>
 #include <glib/gstdio.h>
 #include <glibmm/stringutils.h>
 
 #include <fstream>
+#include <map>
 #include "image/header.h"
 #include "image/mapper.h"
 #include "file/key_value.h"
@@ -42,33 +42,54 @@ namespace MR {
     namespace Format {
 
       namespace {
-
         const gchar* FormatMRtrix = "MRtrix";
-
       }
 
 
 
-      // extensions are: 
-      // mih: MRtrix Image Header
-      // mif: MRtrix Image File
+      void write_MRtrix_header (std::ostream& out, const Header& H)
+      {
+        out << "dim: " << H.axes.dim[0];
+        for (int n = 1; n < H.axes.ndim(); n++) out << "," << H.axes.dim[n];
+
+        out << "\nvox: " << H.axes.vox[0];
+        for (int n = 1; n < H.axes.ndim(); n++) out << "," << H.axes.vox[n];
+
+        out << "\nlayout: " << ( H.axes.forward[0] ? "+" : "-" ) << H.axes.axis[0];
+        for (int n = 1; n < H.axes.ndim(); n++) out << "," << ( H.axes.forward[n] ? "+" : "-" ) << H.axes.axis[n];
+
+        out << "\ndatatype: " << H.data_type.specifier();
+
+        out << "\nlabels: " << H.axes.desc[0];
+        for (int n = 1; n < H.axes.ndim(); n++) out << "\\" << H.axes.desc[n];
+
+        out << "\nunits: " <<  H.axes.units[0];
+        for (int n = 1; n < H.axes.ndim(); n++) out << "\\" << H.axes.units[n];
+
+        for (std::vector<String>::const_iterator i = H.comments.begin(); i != H.comments.end(); i++) 
+          out << "\ncomments: " << *i;
 
-      bool MRtrix::read (Mapper& dmap, Header& H) const
-      { 
-        if (!Glib::str_has_suffix (H.name, ".mih") && !Glib::str_has_suffix (H.name, ".mif") && !Glib::str_has_suffix (H.name, ".mif.gz")) return (false);
 
-        File::KeyValue kv;
-        String gzfilename;
-	if (Glib::str_has_suffix (H.name, ".gz")) {
-          gzfilename = H.name;
-          kv.open (Mapper::gunzip (H.name, "mif"), "mrtrix image");
+        if (H.transform().is_valid()) {
+          out << "\ntransform: " << H.transform() (0,0) << "," <<  H.transform() (0,1) << "," << H.transform() (0,2) << "," << H.transform() (0,3);
+          out << "\ntransform: " << H.transform() (1,0) << "," <<  H.transform() (1,1) << "," << H.transform() (1,2) << "," << H.transform() (1,3);
+          out << "\ntransform: " << H.transform() (2,0) << "," <<  H.transform() (2,1) << "," << H.transform() (2,2) << "," << H.transform() (2,3);
         }
-        else 
-          kv.open (H.name, "mrtrix image");
 
-        H.format = FormatMRtrix;
+        if (H.offset != 0.0 || H.scale != 1.0) 
+          out << "\nscaling: " << H.offset << "," << H.scale;
+
+        if (H.DW_scheme.is_valid()) {
+          for (guint i = 0; i < H.DW_scheme.rows(); i++)
+            out << "\ndw_scheme: " << H.DW_scheme (i,0) << "," << H.DW_scheme (i,1) << "," << H.DW_scheme (i,2) << "," << H.DW_scheme (i,3);
+        }
+      }
+
 
-        String dtype, layout, file;
+
+      void read_MRtrix_header (File::KeyValue& kv, Header& H, std::map<String,String>& other)
+      {
+        String dtype, layout;
         std::vector<int> dim;
         std::vector<float> transform, dw_scheme, vox, scaling;
         std::vector<String> units, labels;
@@ -79,14 +100,13 @@ namespace MR {
           else if (key == "vox") vox = parse_floats (kv.value());
           else if (key == "layout") layout = kv.value();
           else if (key == "datatype") dtype = kv.value();
-          else if (key == "file") file = kv.value();
           else if (key == "scaling") scaling = parse_floats (kv.value());
           else if (key == "comments") H.comments.push_back (kv.value());
           else if (key == "units") units = split (kv.value(), "\\");
           else if (key == "labels") labels = split (kv.value(), "\\");
           else if (key == "transform") { std::vector<float> V (parse_floats (kv.value())); transform.insert (transform.end(), V.begin(), V.end()); }
           else if (key == "dw_scheme") { std::vector<float> V (parse_floats (kv.value())); dw_scheme.insert (dw_scheme.end(), V.begin(), V.end()); }
-          else debug ("unknown key \"" + kv.key() + " in generic image header \"" + H.name + "\" - ignored");
+          else other[key] = kv.value();
         }
 
         if (dim.empty()) throw Exception ("missing \"dim\" specification for generic image \"" + H.name + "\"");
@@ -150,23 +170,55 @@ namespace MR {
           H.offset = scaling[0];
           H.scale = scaling[1];
         }
+      }
+
+
+
+
+      // extensions are: 
+      // mih: MRtrix Image Header
+      // mif: MRtrix Image File
+
+      bool MRtrix::read (Mapper& dmap, Header& H) const
+      { 
+        if (!Glib::str_has_suffix (H.name, ".mih") && !Glib::str_has_suffix (H.name, ".mif") && !Glib::str_has_suffix (H.name, ".mif.gz")) return (false);
+
+        File::KeyValue kv (H.name, "mrtrix image");
+
+        H.format = FormatMRtrix;
+
+        std::map<String,String> other;
+        read_MRtrix_header (kv, H, other);
+
+        String file;
+        for (std::map<String,String>::const_iterator i = other.begin(); i != other.end(); ++i) {
+          if (i->first == "file") file = i->second;
+          else debug ("unknown key \"" + i->first + " in generic image header \"" + H.name + "\" - ignored");
+        }
 
         if (file.empty()) throw Exception ("missing \"file\" specification for generic image \"" + H.name + "\"");
-        std::istringstream files_stream (file);
-        String fname;
-        files_stream >> fname;
-        guint offset = 0;
-        if (files_stream.good()) {
-          try { files_stream >> offset; }
-          catch (...) { throw Exception ("invalid offset specified for file \"" + fname + "\" in generic image header \"" + H.name + "\""); }
+
+        // the file name may contain spaces, so the offset (if any) is the
+        // last entry on the line, provided it is a number:
+        String fname (strip (file));
+        gsize offset = 0;
+        String::size_type space = fname.find_last_of (" \t");
+        if (space != String::npos) {
+          String offset_spec (fname.substr (space+1));
+          if (offset_spec.find_first_not_of ("0123456789") == String::npos) {
+            offset = to<gsize> (offset_spec);
+            fname = strip (fname.substr (0, space));
+          }
         }
 
         if (fname == ".") {
           if (offset == 0) throw Exception ("invalid offset specified for embedded generic image \"" + H.name + "\""); 
-          dmap.add_gz (kv.name(), gzfilename, offset);
+          if (Glib::str_has_suffix (H.name, ".gz")) dmap.add_gz (H.name, offset);
+          else dmap.add (H.name, offset);
         }
         else {
-          fname = Glib::build_filename (Glib::path_get_dirname (H.name), fname);
+          if (!Glib::path_is_absolute (fname))
+            fname = Glib::build_filename (Glib::path_get_dirname (H.name), fname);
 
           ParsedNameList list;
           std::vector<int> num = list.parse_scan_check (fname);
@@ -203,51 +255,11 @@ namespace MR {
         if (!is_temporary (H.name) && Glib::file_test (H.name, Glib::FILE_TEST_IS_REGULAR)) 
           throw Exception ("cannot create generic image file \"" + H.name + "\": file exists");
 
-        String gzfilename, filename (H.name);
-        if (Glib::str_has_suffix (H.name, ".gz")) {
-          gzfilename = H.name;
-          File::MMap fmap ("", 1024, "mif");
-          filename = fmap.name();
-        }
-
-        std::ofstream out (filename.c_str(), std::ios::out | std::ios::binary);
-        if (!out) throw Exception ("error creating file \"" + H.name + "\":" + Glib::strerror(errno));
+        bool is_gz = Glib::str_has_suffix (H.name, ".gz");
+        std::ostringstream out;
 
         out << "mrtrix image\n";
-        out << "dim: " << H.axes.dim[0];
-        for (int n = 1; n < H.axes.ndim(); n++) out << "," << H.axes.dim[n];
-
-        out << "\nvox: " << H.axes.vox[0];
-        for (int n = 1; n < H.axes.ndim(); n++) out << "," << H.axes.vox[n];
-
-        out << "\nlayout: " << ( H.axes.forward[0] ? "+" : "-" ) << H.axes.axis[0];
-        for (int n = 1; n < H.axes.ndim(); n++) out << "," << ( H.axes.forward[n] ? "+" : "-" ) << H.axes.axis[n];
-
-        out << "\ndatatype: " << H.data_type.specifier();
-
-        out << "\nlabels: " << H.axes.desc[0];
-        for (int n = 1; n < H.axes.ndim(); n++) out << "\\" << H.axes.desc[n];
-
-        out << "\nunits: " <<  H.axes.units[0];
-        for (int n = 1; n < H.axes.ndim(); n++) out << "\\" << H.axes.units[n];
-
-        for (std::vector<String>::const_iterator i = H.comments.begin(); i != H.comments.end(); i++) 
-          out << "\ncomments: " << *i;
-
-
-        if (H.transform().is_valid()) {
-          out << "\ntransform: " << H.transform() (0,0) << "," <<  H.transform() (0,1) << "," << H.transform() (0,2) << "," << H.transform() (0,3);
-          out << "\ntransform: " << H.transform() (1,0) << "," <<  H.transform() (1,1) << "," << H.transform() (1,2) << "," << H.transform() (1,3);
-          out << "\ntransform: " << H.transform() (2,0) << "," <<  H.transform() (2,1) << "," << H.transform() (2,2) << "," << H.transform() (2,3);
-        }
-
-        if (H.offset != 0.0 || H.scale != 1.0) 
-          out << "\nscaling: " << H.offset << "," << H.scale;
-
-        if (H.DW_scheme.is_valid()) {
-          for (guint i = 0; i < H.DW_scheme.rows(); i++)
-            out << "\ndw_scheme: " << H.DW_scheme (i,0) << "," << H.DW_scheme (i,1) << "," << H.DW_scheme (i,2) << "," << H.DW_scheme (i,3);
-        }
+        write_MRtrix_header (out, H);
 
         bool single_file = !Glib::str_has_suffix (H.name, ".mih");
 
@@ -260,20 +272,64 @@ namespace MR {
         }
         else out << Glib::path_get_basename (H.name.substr (0, H.name.size()-4) + ".dat") << "\n";
 
-        out.close();
+        if (is_gz) {
+          String text (out.str());
+          std::vector<guint8> header (offset, 0);
+          memcpy (&header[0], text.c_str(), MIN (text.size(), offset));
+          dmap.add_gz (H.name, header);
+          return;
+        }
+
+        std::ofstream file (H.name.c_str(), std::ios::out | std::ios::binary);
+        if (!file) throw Exception ("error creating file \"" + H.name + "\":" + Glib::strerror(errno));
+        file << out.str();
+        file.close();
 
         if (single_file) {
-          int fd = g_open (filename.c_str(), O_RDWR, 0755);
-          if (fd < 0) throw Exception ("error opening file \"" + filename + "\" for resizing: " + Glib::strerror(errno));
+          int fd = g_open (H.name.c_str(), O_RDWR, 0755);
+          if (fd < 0) throw Exception ("error opening file \"" + H.name + "\" for resizing: " + Glib::strerror(errno));
+#ifndef G_OS_WIN32
+          // temporary files are typically held in shared memory: reserve the
+          // space now, so that running out of it is reported here rather
+          // than as a bus error when the data are written:
+          int status = is_temporary (H.name) ? posix_fallocate (fd, 0, offset + H.memory_footprint()) : ftruncate (fd, offset + H.memory_footprint());
+          if (status > 0) errno = status;
+#else
           int status = ftruncate (fd, offset + H.memory_footprint());
+#endif
           close (fd);
-          if (status) throw Exception ("cannot resize file \"" + filename + "\": " + Glib::strerror(errno));
-          dmap.add_gz (filename, gzfilename, offset);
+          if (status) throw Exception ("cannot resize file \"" + H.name + "\": " + Glib::strerror(errno) 
+              + ( is_temporary (H.name) ? " (temporary files can be placed elsewhere using the TmpFileDir config file entry)" : "" ));
+          dmap.add (H.name, offset);
         }
         else dmap.add (H.name.substr (0, H.name.size()-4) + ".dat", 0, H.memory_footprint());
       }
 
 
+
+
+      void create_MRtrix_header (const String& header_name, const Header& H, const String& data_file, gsize offset)
+      {
+        if (!Glib::str_has_suffix (header_name, ".mih")) 
+          throw Exception ("cannot create image header \"" + header_name + "\": only supported for MRtrix .mih headers");
+        if (Glib::file_test (header_name, Glib::FILE_TEST_EXISTS)) 
+          throw Exception ("cannot create image header \"" + header_name + "\": file exists");
+
+        String file (data_file);
+        if (Glib::path_get_dirname (file) == Glib::path_get_dirname (header_name)) file = Glib::path_get_basename (file);
+        else if (!Glib::path_is_absolute (file)) file = Glib::build_filename (Glib::get_current_dir(), file);
+
+        info ("creating image header \"" + header_name + "\" referring to data in \"" + data_file + "\"...");
+
+        std::ofstream out (header_name.c_str(), std::ios::out | std::ios::binary);
+        if (!out) throw Exception ("error creating file \"" + header_name + "\":" + Glib::strerror(errno));
+        out << "mrtrix image\n";
+        write_MRtrix_header (out, H);
+        out << "\nfile: " << file << " " << offset << "\nEND\n";
+        if (!out) throw Exception ("error writing file \"" + header_name + "\":" + Glib::strerror(errno));
+      }
+
+
     }
   }
 }
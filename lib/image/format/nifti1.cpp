@@ -24,6 +24,7 @@
 #include <glibmm/stringutils.h>
 
 #include "file/nifti1.h"
+#include "file/gz.h"
 #include "image/mapper.h"
 #include "get_set.h"
 #include "image/format/list.h"
@@ -43,19 +44,22 @@ namespace MR {
           return (false);
 
         File::MMap fmap;
-        String gzfilename;
-        if (Glib::str_has_suffix (H.name, ".gz")) {
-          gzfilename = H.name;
-          fmap.init (Mapper::gunzip (H.name, "nii"));
+        nifti_1_header gzheader;
+        const nifti_1_header* NH;
+        bool is_gz = Glib::str_has_suffix (H.name, ".gz");
+        if (is_gz) {
+          File::GZ zf (H.name);
+          zf.read (&gzheader, sizeof (nifti_1_header));
+          NH = &gzheader;
         }
-        else 
+        else {
           fmap.init (H.name);
+          fmap.map();
+          NH = (const nifti_1_header*) fmap.address();
+        }
 
-        fmap.map();
         H.format = FormatNIfTI;
 
-        const nifti_1_header* NH = (const nifti_1_header*) fmap.address();
-
         bool is_BE = false;
         if (get<gint32> (&NH->sizeof_hdr, is_BE) != 348) {
           is_BE = true;
@@ -237,8 +241,11 @@ namespace MR {
           }
         }
 
-        fmap.unmap();
-        dmap.add_gz (fmap, gzfilename, data_offset);
+        if (is_gz) dmap.add_gz (H.name, data_offset);
+        else {
+          fmap.unmap();
+          dmap.add (fmap, data_offset);
+        }
 
         return (true);
       }
@@ -271,6 +278,11 @@ namespace MR {
         H.axes.desc[2] = Axis::inferior_to_superior;
         H.axes.units[2] = Axis::millimeters;
 
+        if (H.data_type == DataType::Float16 || H.data_type == DataType::Float16LE || H.data_type == DataType::Float16BE) {
+          H.data_type = DataType::Float32;
+          info ("WARNING: changing data type to Float32 for image \"" + H.name + "\" since NIfTI-1.1 does not support half-precision data");
+        }
+
         return (true);
       }
 
@@ -286,17 +298,20 @@ namespace MR {
         guint msize = H.memory_footprint (H.ndim());
 
         File::MMap fmap;
-        String gzfilename;
-        if (Glib::str_has_suffix (H.name, ".gz")) {
-          gzfilename = H.name;
-          fmap.init (String(), 352 + msize, "nii");
+        std::vector<guint8> gzheader;
+        nifti_1_header* NH;
+        bool is_gz = Glib::str_has_suffix (H.name, ".gz");
+        if (is_gz) {
+          if (Glib::file_test (H.name, Glib::FILE_TEST_EXISTS)) 
+            throw Exception ("cannot create NIfTI image \"" + H.name + "\": file exists");
+          gzheader.resize (352, 0);
+          NH = (nifti_1_header*) &gzheader[0];
         }
-        else 
+        else {
           fmap.init (H.name, 352 + msize);
-
-        fmap.map();
-
-        nifti_1_header* NH = (nifti_1_header*) fmap.address();
+          fmap.map();
+          NH = (nifti_1_header*) fmap.address();
+        }
 
         bool is_BE = H.data_type.is_big_endian();
 
@@ -414,9 +429,11 @@ namespace MR {
 
 
         strncpy ((gchar*) &NH->magic, "n+1\0", 4);
-        fmap.unmap();
-
-        dmap.add_gz (fmap, gzfilename, 352);
+        if (is_gz) dmap.add_gz (H.name, gzheader);
+        else {
+          fmap.unmap();
+          dmap.add (fmap, 352);
+        }
       }
 
     }
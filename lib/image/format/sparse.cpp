@@ -0,0 +1,144 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <glibmm/fileutils.h>
+#include <glibmm/stringutils.h>
+
+#include <map>
+#include "image/header.h"
+#include "image/mapper.h"
+#include "image/sparse.h"
+#include "file/key_value.h"
+#include "file/config.h"
+#include "image/format/list.h"
+
+#define SPARSE_BLOCK_SIZE 4096
+
+namespace MR {
+  namespace Image {
+    namespace Format {
+
+      namespace {
+        const gchar* FormatSparse = "MRtrix sparse";
+      }
+
+
+
+      // extension is:
+      // msf: MRtrix Sparse File
+      //
+      // The header is the same as for the MRtrix format, with the addition of
+      // the "block_size" (in elements) and "compression" entries. The "file"
+      // entry gives the offset to the block index, which holds a pair of
+      // little-endian 64-bit integers for each block: its offset in the file
+      // (zero for empty blocks) and its size in bytes.
+
+      bool MRtrixSparse::read (Mapper& dmap, Header& H) const
+      {
+        if (!Glib::str_has_suffix (H.name, ".msf")) return (false);
+
+        File::KeyValue kv (H.name, "mrtrix sparse image");
+
+        H.format = FormatSparse;
+
+        std::map<String,String> other;
+        read_MRtrix_header (kv, H, other);
+
+        gsize block_size = 0, offset = 0;
+        bool compressed = false;
+        for (std::map<String,String>::const_iterator i = other.begin(); i != other.end(); ++i) {
+          if (i->first == "block_size") block_size = to<gsize> (i->second);
+          else if (i->first == "compression") {
+            String method = lowercase (i->second);
+            if (method == "deflate") compressed = true;
+            else if (method != "none")
+              throw Exception ("unsupported compression \"" + i->second + "\" for sparse image \"" + H.name + "\"");
+          }
+          else if (i->first == "file") {
+            std::istringstream file_stream (i->second);
+            String fname;
+            file_stream >> fname >> offset;
+            if (fname != ".")
+              throw Exception ("sparse image \"" + H.name + "\" must hold its data in the same file");
+          }
+          else debug ("unknown key \"" + i->first + " in sparse image header \"" + H.name + "\" - ignored");
+        }
+
+        if (!block_size || block_size % 8)
+          throw Exception ("invalid \"block_size\" specification for sparse image \"" + H.name + "\"");
+        if (!offset)
+          throw Exception ("missing or invalid \"file\" specification for sparse image \"" + H.name + "\"");
+
+        dmap.add (new Image::Sparse (H.name, offset, block_size, compressed));
+        return (true);
+      }
+
+
+
+
+
+      bool MRtrixSparse::check (Header& H, int num_axes) const
+      {
+        if (!Glib::str_has_suffix (H.name, ".msf")) return (false);
+
+        H.format = FormatSparse;
+
+        H.axes.set_ndim (num_axes);
+        for (int i = 0; i < H.axes.ndim(); i++)
+          if (H.axes.dim[i] < 1) H.axes.dim[i] = 1;
+
+        return (true);
+      }
+
+
+
+
+
+      void MRtrixSparse::create (Mapper& dmap, const Header& H) const
+      {
+        if (Glib::file_test (H.name, Glib::FILE_TEST_EXISTS))
+          throw Exception ("cannot create sparse image file \"" + H.name + "\": file exists");
+
+        bool compress = File::Config::get_bool ("Sparse.Compress", false);
+
+        std::ostringstream out;
+        out << "mrtrix sparse image\n";
+        write_MRtrix_header (out, H);
+        out << "\nblock_size: " << SPARSE_BLOCK_SIZE;
+        out << "\ncompression: " << ( compress ? "deflate" : "none" );
+        out << "\nfile: ";
+        size_t offset = out.tellp();
+        offset += 14;
+        out << ". " << offset << "\nEND\n";
+
+        String text (out.str());
+        std::vector<guint8> header (offset, 0);
+        memcpy (&header[0], text.c_str(), MIN (text.size(), offset));
+
+        // nothing is written until the image is closed:
+        dmap.add (new Image::Sparse (H.name, header, SPARSE_BLOCK_SIZE, compress));
+      }
+
+    }
+  }
+}
+
@@ -26,6 +26,7 @@
 #include "image/position.h"
 #include "image/object.h"
 #include "point.h"
+#include "math/small_matrix.h"
 
 namespace MR {
   namespace Image {
@@ -93,22 +94,22 @@ namespace MR {
             Map (const Image::Object& dest, const Image::Object& source) { set (dest, source); }
             void set (const Image::Object& dest, const Image::Object& source) 
             {
-              Math::Matrix M;
-              M.multiply (dest.header().R2P(), source.header().P2R());
-              R[0] = M(0,0); R[1] = M(0,1); R[2] = M(0,2); R[3] = M(0,3); 
-              R[4] = M(1,0); R[5] = M(1,1); R[6] = M(1,2); R[7] = M(1,3);
-              R[8] = M(2,0); R[9] = M(2,1); R[10]= M(2,2); R[11]= M(2,3);
+              Math::SmallMatrix<double,4,4> R2P (dest.header().R2P()), P2R (source.header().P2R()), M;
+              M.multiply (R2P, P2R);
+              for (int i = 0; i < 3; i++)
+                for (int j = 0; j < 4; j++)
+                  R(i,j) = M(i,j);
             }
             Point operator() (const Point& P) const 
             {
               return (Point (
-                    R[0]*P[0] + R[1]*P[1] + R[2]*P[2] + R[3],
-                    R[4]*P[0] + R[5]*P[1] + R[6]*P[2] + R[7],
-                    R[8]*P[0] + R[9]*P[1] + R[10]*P[2] + R[11] ));
+                    R(0,0)*P[0] + R(0,1)*P[1] + R(0,2)*P[2] + R(0,3),
+                    R(1,0)*P[0] + R(1,1)*P[1] + R(1,2)*P[2] + R(1,3),
+                    R(2,0)*P[0] + R(2,1)*P[1] + R(2,2)*P[2] + R(2,3) ));
             }
             Point operator() (const Position& P) const { return (operator() (Point (P[0], P[1], P[2]))); }
           protected:
-            float R[12];
+            Math::SmallMatrix<float,3,4> R;
 
         };
 
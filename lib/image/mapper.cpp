@@ -23,16 +23,25 @@
     * use template get<T>() & put<T>() methods from lib/get_set.h
 */
 
-#include <zlib.h>
 #include <fcntl.h>
 
 #include <glib/gstdio.h>
+#ifdef __F16C__
+#include <immintrin.h>
+#endif
 
 #include "image/mapper.h"
+#include "file/gz.h"
 #include "app.h"
 #include "get_set.h"
+#include "file/config.h"
+#include "thread.h"
 
 #define DATAMAPPER_MAX_FILES 128
+#define DATAMAPPER_GZ_CHUNK 1048576
+#define DATAMAPPER_CONVERT_CHUNK 262144
+#define DATAMAPPER_MIN_SLAB_SIZE 1048576
+#define DATAMAPPER_STREAM_BUFFER_SIZE 256
 
 namespace MR {
   namespace Image {
@@ -47,6 +56,155 @@ namespace MR {
         return (segsize);
       }
 
+
+
+      // conversion of a contiguous run of elements to and from float32. These
+      // are simple enough loops for the compiler to unroll and vectorise: 
+      // the first and count arguments refer to elements, and dest/src point
+      // to the first element to be converted.
+
+      template <typename T> void load_native (const void* data, float32* dest, gsize first, gsize count)
+      {
+        const T* in = (const T*) data + first;
+        for (gsize i = 0; i < count; i++) dest[i] = in[i];
+      }
+
+      template <typename T> void load_LE (const void* data, float32* dest, gsize first, gsize count)
+      {
+        const T* in = (const T*) data + first;
+        for (gsize i = 0; i < count; i++) dest[i] = ByteOrder::LE (in[i]);
+      }
+
+      template <typename T> void load_BE (const void* data, float32* dest, gsize first, gsize count)
+      {
+        const T* in = (const T*) data + first;
+        for (gsize i = 0; i < count; i++) dest[i] = ByteOrder::BE (in[i]);
+      }
+
+      // half-precision data are converted 8 values at a time in hardware
+      // if compiled with F16C support (e.g. using -mf16c or -march=native):
+      template <bool BigEndian> void load_float16 (const void* data, float32* dest, gsize first, gsize count)
+      {
+        const guint16* in = (const guint16*) data + first;
+        gsize i = 0;
+#ifdef __F16C__
+        if (BigEndian == MRTRIX_IS_BIG_ENDIAN) 
+          for (; i+8 <= count; i += 8) 
+            _mm256_storeu_ps (dest+i, _mm256_cvtph_ps (_mm_loadu_si128 ((const __m128i*) (in+i))));
+#endif
+        for (; i < count; i++) dest[i] = half_to_float (BigEndian ? ByteOrder::BE (in[i]) : ByteOrder::LE (in[i]));
+      }
+
+      void load_bit (const void* data, float32* dest, gsize first, gsize count)
+      {
+        gsize i = 0;
+        for (; i < count && (first+i) % 8; i++) dest[i] = get<bool> (data, first+i);
+        const guint8* in = (const guint8*) data + (first+i)/8;
+        for (; i+8 <= count; i += 8, in++) 
+          for (guint b = 0; b < 8; b++) 
+            dest[i+b] = ( *in << b ) & BITMASK ? 1.0 : 0.0;
+        for (; i < count; i++) dest[i] = get<bool> (data, first+i);
+      }
+
+
+
+      template <typename T> void store_native (const float32* src, void* data, gsize first, gsize count)
+      {
+        T* out = (T*) data + first;
+        for (gsize i = 0; i < count; i++) out[i] = T (src[i]);
+      }
+
+      template <typename T> void store_LE (const float32* src, void* data, gsize first, gsize count)
+      {
+        T* out = (T*) data + first;
+        for (gsize i = 0; i < count; i++) out[i] = ByteOrder::LE (T (src[i]));
+      }
+
+      template <typename T> void store_BE (const float32* src, void* data, gsize first, gsize count)
+      {
+        T* out = (T*) data + first;
+        for (gsize i = 0; i < count; i++) out[i] = ByteOrder::BE (T (src[i]));
+      }
+
+      template <bool BigEndian> void store_float16 (const float32* src, void* data, gsize first, gsize count)
+      {
+        guint16* out = (guint16*) data + first;
+        gsize i = 0;
+#ifdef __F16C__
+        if (BigEndian == MRTRIX_IS_BIG_ENDIAN) 
+          for (; i+8 <= count; i += 8) 
+            _mm_storeu_si128 ((__m128i*) (out+i), _mm256_cvtps_ph (_mm256_loadu_ps (src+i), _MM_FROUND_TO_NEAREST_INT));
+#endif
+        for (; i < count; i++) {
+          guint16 h = float_to_half (src[i]);
+          out[i] = BigEndian ? ByteOrder::BE (h) : ByteOrder::LE (h);
+        }
+      }
+
+      void store_bit (const float32* src, void* data, gsize first, gsize count)
+      {
+        gsize i = 0;
+        for (; i < count && (first+i) % 8; i++) put<bool> (bool (src[i]), data, first+i);
+        guint8* out = (guint8*) data + (first+i)/8;
+        for (; i+8 <= count; i += 8, out++) {
+          guint8 byte = 0;
+          for (guint b = 0; b < 8; b++) 
+            if (src[i+b]) byte |= BITMASK >> b;
+          *out = byte;
+        }
+        for (; i < count; i++) put<bool> (bool (src[i]), data, first+i);
+      }
+
+
+
+
+      // convert in chunks across multiple threads. Chunks are a multiple of 8
+      // elements, so that no two threads ever write to the same byte of
+      // bitwise data.
+      class Loader {
+        public:
+          Loader (void (*function) (const void*, float32*, gsize, gsize), const void* data, float32* dest, gsize count) : 
+            func (function), in (data), out (dest), loop (count, DATAMAPPER_CONVERT_CHUNK) { }
+
+          void execute () 
+          {
+            gsize first, last;
+            while (loop.next (first, last)) 
+              func (in, out + first, first, last - first);
+          }
+
+        private:
+          void (*func) (const void*, float32*, gsize, gsize);
+          const void* in;
+          float32* out;
+          Thread::Loop loop;
+      };
+
+      class Storer {
+        public:
+          Storer (void (*function) (const float32*, void*, gsize, gsize), const float32* src, void* data, gsize count) : 
+            func (function), in (src), out (data), loop (count, DATAMAPPER_CONVERT_CHUNK) { }
+
+          void execute () 
+          {
+            gsize first, last;
+            while (loop.next (first, last)) 
+              func (in + first, out, first, last - first);
+          }
+
+        private:
+          void (*func) (const float32*, void*, gsize, gsize);
+          const float32* in;
+          void* out;
+          Thread::Loop loop;
+      };
+
+      inline guint num_threads_for (gsize count)
+      {
+        gsize nchunks = (count + DATAMAPPER_CONVERT_CHUNK - 1) / DATAMAPPER_CONVERT_CHUNK;
+        return (MIN (gsize (Thread::number()), nchunks));
+      }
+
     }
 
 
@@ -59,14 +217,8 @@ namespace MR {
       if (mem && list.size()) 
         throw Exception ("Mapper destroyed before committing data to file!"); 
 
-      for (guint n = 0; n < list.size(); ++n) {
-        if (list[n].gzfilename.size()) {
-          if (!list[n].fmap.is_read_only()) 
-            gzip (list[n].fmap.name(), list[n].gzfilename);
-          debug ("deleting temporary file \"" + list[n].fmap.name() + "\"...");
-          unlink (list[n].fmap.name().c_str());
-        }
-      }
+      delete sparse;
+      delete slabs;
 
       if (output_name.size()) 
         std::cout << output_name << "\n";
@@ -81,17 +233,46 @@ namespace MR {
     void Mapper::map (const Header& H)
     {
       debug ("mapping image \"" + H.name + "\"...");
-      assert (list.size() || mem);
+      assert (list.size() || mem || sparse || shared);
       assert (segment == NULL);
 
-      if (list.size() > DATAMAPPER_MAX_FILES || 
-          ( optimised && ( list.size() > 1 || H.data_type != DataType::Native )) ) {
+      if (shared) {
+        if (!shared->mem) 
+          throw Exception ("image \"" + H.name + "\" shares its data with an image that is not currently mapped");
+        mem = shared->mem;
+      }
+
+      if (sparse) {
+        optimised = false;
+        sparse->map (H);
+        segment = new guint8* [sparse->num_blocks()];
+        for (gsize n = 0; n < sparse->num_blocks(); n++) 
+          segment[n] = NULL;
+        segsize = sparse->block_size();
+        debug ("data mapper for sparse image \"" + H.name + "\" mapped with block size = " + str (segsize));
+        return;
+      }
+
+      if (streaming) {
+        if (is_compressed()) {
+          if (map_slabs (H)) return;
+        }
+        else {
+          // access the files directly rather than loading them into memory,
+          // and let the system read ahead and discard pages behind us:
+          if (list.size() > 1 || H.data_type != DataType::Native) optimised = false;
+          for (guint n = 0; n < list.size(); n++) 
+            list[n].fmap.set_sequential();
+        }
+      }
+
+      if (is_compressed() || ( !mem && optimised && ( list.size() > 1 || H.data_type != DataType::Native )) ) {
 
         if (H.data_type == DataType::Bit) optimised = true;
 
         info (String ("loading ") + ( optimised ? "and optimising " : "" ) + "image \"" + H.name + "\"..."); 
 
-        bool read_only = list[0].fmap.is_read_only();
+        bool read_only = is_compressed() ? !files_new : list[0].fmap.is_read_only();
 
         gsize bpp = optimised ? sizeof (float32) : H.data_type.bytes();
         mem = new guint8 [bpp*H.voxel_count()];
@@ -102,14 +283,14 @@ namespace MR {
           segsize = calc_segsize (H, list.size());
 
           for (guint n = 0; n < list.size(); n++) {
+            if (list[n].gzfilename.size()) {
+              load_gz (H, list[n], mem + n*segsize*bpp, segsize);
+              continue;
+            }
+
             list[n].fmap.map (); 
 
-            if (optimised) {
-              float32* data = (float32*) mem + n*segsize;
-              guint8*   fdata = list[n].start();
-              for (gsize i = 0; i < segsize; i++) 
-                data[i] = get_func (fdata, i); 
-            } 
+            if (optimised) load (list[n].start(), (float32*) mem + n*segsize, segsize);
             else memcpy (mem + n*segsize*bpp, list[n].start(), segsize*bpp);
 
             list[n].fmap.unmap();
@@ -125,6 +306,22 @@ namespace MR {
         segsize = optimised ? sizeof (float32) : H.data_type.bytes();
         segsize *= H.voxel_count();
       }
+      else if (list.size() > DATAMAPPER_MAX_FILES) {
+        int max_files = File::Config::get_int ("MaxMappedFiles", DATAMAPPER_MAX_FILES);
+        max_mapped = max_files < 1 ? 1 : max_files;
+        segment = new guint8* [list.size()];
+        for (guint n = 0; n < list.size(); n++) 
+          segment[n] = NULL;
+        last_used.assign (list.size(), 0);
+        mapped.clear();
+        access_count = 0;
+        current = G_MAXSIZE;
+        owner = NULL;
+        multithreaded = false;
+        segsize = calc_segsize (H, list.size());
+        info ("image \"" + H.name + "\" spans " + str (list.size()) + " files - these will be mapped on demand, at most " 
+            + str (max_mapped) + " at a time");
+      }
       else {
         segment = new guint8* [list.size()];
         for (guint n = 0; n < list.size(); n++) {
@@ -145,6 +342,27 @@ namespace MR {
 
     void Mapper::unmap (const Header& H)
     {
+      if (sparse) {
+        sparse->unmap (H);
+        delete [] segment;
+        segment = NULL;
+        return;
+      }
+
+      if (slabs) {
+        delete slabs;
+        slabs = NULL;
+        delete [] segment;
+        segment = NULL;
+        return;
+      }
+
+      if (!segment && files_new && is_compressed()) {
+        for (guint n = 0; n < list.size(); n++) 
+          write_gz (H, list[n], NULL, calc_segsize (H, list.size()));
+        files_new = false;
+      }
+
       if (mem && list.size()) {
         segsize = calc_segsize (H, list.size());
         if (!optimised) segsize *= H.data_type.bytes();
@@ -152,24 +370,39 @@ namespace MR {
         info ("writing back data for image \"" + H.name + "\"...");
         for (guint n = 0; n < list.size(); n++) {
           try { 
+            if (list[n].gzfilename.size()) {
+              if (optimised) write_gz (H, list[n], (const guint8*) ((const float32*) mem + n*segsize), segsize);
+              else write_gz (H, list[n], mem + n*segsize, segsize / H.data_type.bytes());
+              continue;
+            }
+
             list[n].fmap.map (); 
-            if (optimised) {
-              const float32* data = (const float32*) mem + n*segsize;
-              for (gsize i = 0; i < segsize; i++) 
-                put_func (data[i], list[n].start(), i); 
-            } 
+            if (optimised) store ((const float32*) mem + n*segsize, list[n].start(), segsize);
             else memcpy (list[n].start(), mem + n*segsize, segsize);
             list[n].fmap.unmap();
           }
           catch (...) {
-            error ("error writing data to file \"" + list[n].fmap.name() + "\""); 
+            error ("error writing data to file \"" + ( list[n].gzfilename.size() ? list[n].gzfilename : list[n].fmap.name() ) + "\""); 
           }
         }
       }
 
-      delete [] mem;
-      delete [] segment;
+      if (mem && is_compressed()) files_new = false;
+
+      if (max_mapped) {
+        if (mapped.size() > max_mapped) 
+          info ("image \"" + H.name + "\" was accessed from more than one thread - " + str (mapped.size()) 
+              + " of its files were mapped at once");
+        for (guint n = 0; n < mapped.size(); n++) 
+          list[mapped[n]].fmap.unmap();
+        mapped.clear();
+        last_used.clear();
+        max_mapped = 0;
+      }
+
+      if (!shared) delete [] mem;
       mem = NULL;
+      delete [] segment;
       segment = NULL;
     }
 
@@ -177,106 +410,279 @@ namespace MR {
 
 
 
-    void Mapper::set_data_type (DataType dt)
+
+    void Mapper::map_segment (guint nseg) const
     {
-      switch (dt() & ~DataType::ComplexNumber) {
-        case DataType::Bit:        get_func = getBit;        put_func = putBit;        return;
-        case DataType::Int8:       get_func = getInt8;       put_func = putInt8;       return;
-        case DataType::UInt8:      get_func = getUInt8;      put_func = putUInt8;      return;
-        case DataType::Int16LE:    get_func = getInt16LE;    put_func = putInt16LE;    return;
-        case DataType::UInt16LE:   get_func = getUInt16LE;   put_func = putUInt16LE;   return;
-        case DataType::Int16BE:    get_func = getInt16BE;    put_func = putInt16BE;    return;
-        case DataType::UInt16BE:   get_func = getUInt16BE;   put_func = putUInt16BE;   return;
-        case DataType::Int32LE:    get_func = getInt32LE;    put_func = putInt32LE;    return;
-        case DataType::UInt32LE:   get_func = getUInt32LE;   put_func = putUInt32LE;   return;
-        case DataType::Int32BE:    get_func = getInt32BE;    put_func = putInt32BE;    return;
-        case DataType::UInt32BE:   get_func = getUInt32BE;   put_func = putUInt32BE;   return;
-        case DataType::Float32LE:  get_func = getFloat32LE;  put_func = putFloat32LE;  return;
-        case DataType::Float32BE:  get_func = getFloat32BE;  put_func = putFloat32BE;  return;
-        case DataType::Float64LE:  get_func = getFloat64LE;  put_func = putFloat64LE;  return;
-        case DataType::Float64BE:  get_func = getFloat64BE;  put_func = putFloat64BE;  return;
-        default: throw Exception ("invalid data type in image header");
-      }
+      Glib::Mutex::Lock lock (mutex);
+      if (segment[nseg]) return;
+
+      segment[nseg] = sparse->block (nseg);
     }
 
 
 
 
-    void Mapper::gzip (const String& original, const String& gzfile)
+
+    // record which thread is accessing the data, and map the segment if
+    // necessary. The owner only takes this path when switching to a
+    // different segment, so this is also where it updates the LRU state:
+    void Mapper::acquire_segment (gsize nseg) const
     {
-      FILE* infile = fopen (original.c_str(), "rb");
-      if (!infile) 
-        throw Exception ("error opening temporary file \"" + original + "\": " + strerror(errno));
+      Glib::Mutex::Lock lock (mutex);
+      Glib::Thread* self = Glib::Thread::self();
+      if (!owner) owner = self;
+      else if (self != owner) multithreaded = true;
+
+      if (!segment[nseg]) {
+        if (slabs) map_slab (nseg);
+        else map_file (nseg);
+      }
+
+      if (self == owner) {
+        if (slabs) slabs->used (nseg);
+        else last_used[nseg] = ++access_count;
+        current = nseg;
+      }
+    }
+
+
+
 
-      info ("writing compressed data to \"" +  gzfile + "\"...");
 
-      int fid = g_open (gzfile.c_str(), O_CREAT | O_RDWR | O_EXCL, 0755);
-      if (fid < 0) {
-        fclose (infile);
-        throw Exception ("error creating file \"" + gzfile + "\": " + Glib::strerror(errno));
+    // must be called with the mutex held. Files are only unmapped while a
+    // single thread is accessing the data, since that thread only ever uses
+    // the segment it last acquired, which is also the most recently used:
+    void Mapper::map_file (gsize nseg) const
+    {
+      // mapping a file does not change the data it holds:
+      std::vector<Entry>& files (const_cast<std::vector<Entry>&> (list));
+
+      if (mapped.size() < max_mapped || multithreaded) mapped.push_back (nseg);
+      else {
+        guint oldest = 0;
+        for (guint n = 1; n < mapped.size(); n++) 
+          if (last_used[mapped[n]] < last_used[mapped[oldest]]) 
+            oldest = n;
+        debug ("unmapping file \"" + files[mapped[oldest]].fmap.name() + "\"");
+        segment[mapped[oldest]] = NULL;
+        files[mapped[oldest]].fmap.unmap();
+        mapped[oldest] = nseg;
       }
 
-      gzFile outfile = gzdopen (fid, "wb6");
-      if (!outfile) {
-        fclose (infile);
-        close (fid);
-        throw Exception ("error opening GZIP file \"" + gzfile + "\" for writing");
+      files[nseg].fmap.map();
+      segment[nseg] = files[nseg].start();
+    }
+
+
+
+
+
+    // must be called with the mutex held. The buffer of a discarded slab is
+    // reused, so slabs are only discarded on the same terms as files:
+    void Mapper::map_slab (gsize nseg) const
+    {
+      std::vector<gsize> discarded;
+      segment[nseg] = slabs->slab (nseg, discarded, multithreaded);
+      for (guint n = 0; n < discarded.size(); n++) 
+        segment[discarded[n]] = NULL;
+    }
+
+
+
+
+
+
+    void Mapper::modify_segment (guint nseg)
+    {
+      Glib::Mutex::Lock lock (mutex);
+      if (sparse->is_modified (nseg)) return;
+      // the block must only be flagged as modified once the segment points
+      // to the writable copy, since other threads rely on the flag alone:
+      segment[nseg] = sparse->modify (nseg);
+      sparse->mark_modified (nseg);
+    }
+
+
+
+
+
+
+    /** \brief set up streaming access to compressed image data, one slab at a time.
+     *
+     * A slab holds a whole number of planes along the slowest axis of the
+     * image as stored (or a whole file, if the image spans several files),
+     * and is at least DATAMAPPER_MIN_SLAB_SIZE bytes where possible. The
+     * number of slabs held in memory at once is set by the StreamBufferSize
+     * config file entry (in MB), although all slabs are kept once more than
+     * one thread has accessed the data (see get_segment()).
+     * \return false if the image cannot be streamed, in which case it will
+     * be loaded into memory as usual. */
+    bool Mapper::map_slabs (const Header& H)
+    {
+      if (files_new) {
+        info ("image \"" + H.name + "\" will be written in compressed form - it will be held in memory");
+        return (false);
       }
 
-      char buf[BUFSIZ];
-      int numBytesRead;
-      while ((numBytesRead = fread(buf, 1, BUFSIZ, infile)) > 0) {
-        int numBytesWritten = gzwrite (outfile, buf, numBytesRead);
-        if (numBytesWritten == 0) {
-          fclose (infile);
-          gzclose (outfile);
-          throw Exception ("error writing to GZIP file \"" + gzfile + "\"");
+      const guint bits = H.data_type.is_complex() ? H.data_type.bits()/2 : H.data_type.bits();
+      const gsize per_file = calc_segsize (H, list.size());
+
+      gsize nslabs = 1;
+      if (list.size() == 1) {
+        int slowest = -1;
+        for (int i = 0; i < H.axes.ndim(); i++) 
+          if (H.axes.dim[i] > 1 && ( slowest < 0 || H.axes.axis[i] > H.axes.axis[slowest] )) 
+            slowest = i;
+
+        if (slowest >= 0) {
+          const gsize nplanes = H.axes.dim[slowest];
+          const gsize plane_bytes = ( per_file / nplanes ) * bits / 8;
+          gsize planes = 1;
+          while (planes < nplanes && ( nplanes % planes || planes * plane_bytes < DATAMAPPER_MIN_SLAB_SIZE )) planes++;
+          nslabs = nplanes / planes;
         }
       }
-      fclose (infile);
-      gzclose (outfile);
-    }	
 
+      segsize = per_file / nslabs;
+      if ((segsize * bits) % 8) {
+        info ("slabs of image \"" + H.name + "\" do not start on a byte boundary - it will be held in memory");
+        return (false);
+      }
+
+      const gsize slab_bytes = segsize * bits / 8;
+      const gsize buffer_size = gsize (File::Config::get_int ("StreamBufferSize", DATAMAPPER_STREAM_BUFFER_SIZE)) << 20;
+
+      std::vector<String> filenames (list.size());
+      std::vector<gsize> offsets (list.size());
+      for (guint n = 0; n < list.size(); n++) {
+        filenames[n] = list[n].gzfilename;
+        offsets[n] = list[n].offset;
+      }
 
+      const gsize max_resident = buffer_size / slab_bytes;
 
-    String Mapper::gunzip (const String& gzfile, const char* suffix)
+      optimised = false;
+      slabs = new SlabStream (filenames, offsets, slab_bytes, nslabs, max_resident);
+      current = G_MAXSIZE;
+      owner = NULL;
+      multithreaded = false;
+
+      segment = new guint8* [slabs->num_slabs()];
+      for (gsize n = 0; n < slabs->num_slabs(); n++)
+        segment[n] = NULL;
+
+      info ("streaming image \"" + H.name + "\" in " + str (slabs->num_slabs()) + " slabs of " + str (slab_bytes) 
+          + " bytes, at most " + str (slabs->max_resident()) + " at a time");
+      return (true);
+    }
+
+
+
+
+
+    void Mapper::load_gz (const Header& H, const Entry& entry, guint8* dest, gsize nelements) const
     {
-      info ("uncompressing file \""  + gzfile +  "\"...");
+      const guint bits = H.data_type.is_complex() ? H.data_type.bits()/2 : H.data_type.bits();
+      File::GZ zf (entry.gzfilename);
+      zf.skip (entry.offset);
 
-      String uncompressed;
-      {
-        File::MMap fmap ("", 1024, suffix);
-        uncompressed = fmap.name();
+      if (!optimised) {
+        zf.read (dest, (nelements*bits + 7)/8);
+        return;
       }
 
-      debug ("gunzip file \"" + gzfile +  " to \""  +  uncompressed + "\"...");
-
-      gzFile infile = gzopen (gzfile.c_str(), "rb");
-      if (!infile) {
-        unlink (uncompressed.c_str());
-        throw Exception ("error opening GZIP file \"" + gzfile + "\": " + strerror (errno));
+      std::vector<guint8> buffer ((DATAMAPPER_GZ_CHUNK*bits)/8);
+      float32* data = (float32*) dest;
+      for (gsize n = 0; n < nelements; n += DATAMAPPER_GZ_CHUNK) {
+        gsize count = MIN (nelements - n, gsize (DATAMAPPER_GZ_CHUNK));
+        zf.read (&buffer[0], (count*bits + 7)/8);
+        load (&buffer[0], data + n, count);
       }
+    }
 
-      FILE* outfile = fopen (uncompressed.c_str(), "wb");
-      char buf[BUFSIZ];
-      int numBytesRead;
-      while ((numBytesRead = gzread (infile, buf, BUFSIZ)) > 0) {
-        int numBytesWritten = fwrite (buf, 1, numBytesRead, outfile);
-        if (numBytesWritten == 0) {
-          fclose (outfile);
-          gzclose (infile);
-          throw Exception ("error uncompressing file \"" + gzfile + "\"");
-        }
+
+
+
+
+    void Mapper::write_gz (const Header& H, const Entry& entry, const guint8* src, gsize nelements) const
+    {
+      const guint bits = H.data_type.is_complex() ? H.data_type.bits()/2 : H.data_type.bits();
+      const gsize nbytes = (nelements*bits + 7)/8;
+      const guint8* header = entry.gzheader.size() ? &entry.gzheader[0] : NULL;
+
+      if (!optimised || !src) {
+        File::gzip (entry.gzfilename, header, entry.gzheader.size(), src, nbytes);
+        return;
       }
 
-      fclose (outfile);
-      gzclose (infile);
+      std::vector<guint8> buffer (nbytes, 0);
+      store ((const float32*) src, &buffer[0], nelements);
+      File::gzip (entry.gzfilename, header, entry.gzheader.size(), &buffer[0], nbytes);
+    }
+
 
-      return uncompressed;
+
+
+
+    void Mapper::load (const void* data, float32* dest, gsize count) const
+    {
+      Loader loader (load_func, data, dest, count);
+      Thread::run (loader, num_threads_for (count));
     }
 
 
 
+    void Mapper::store (const float32* src, void* data, gsize count) const
+    {
+      Storer storer (store_func, src, data, count);
+      Thread::run (storer, num_threads_for (count));
+    }
+
+
+
+
+
+    void Mapper::set_data_type (DataType dt)
+    {
+      switch (dt() & ~DataType::ComplexNumber) {
+        case DataType::Bit:        get_func = getBit;        put_func = putBit;        
+                                   load_func = load_bit;                store_func = store_bit;                return;
+        case DataType::Int8:       get_func = getInt8;       put_func = putInt8;       
+                                   load_func = load_native<gint8>;      store_func = store_native<gint8>;      return;
+        case DataType::UInt8:      get_func = getUInt8;      put_func = putUInt8;      
+                                   load_func = load_native<guint8>;     store_func = store_native<guint8>;     return;
+        case DataType::Int16LE:    get_func = getInt16LE;    put_func = putInt16LE;    
+                                   load_func = load_LE<gint16>;         store_func = store_LE<gint16>;         return;
+        case DataType::UInt16LE:   get_func = getUInt16LE;   put_func = putUInt16LE;   
+                                   load_func = load_LE<guint16>;        store_func = store_LE<guint16>;        return;
+        case DataType::Int16BE:    get_func = getInt16BE;    put_func = putInt16BE;    
+                                   load_func = load_BE<gint16>;         store_func = store_BE<gint16>;         return;
+        case DataType::UInt16BE:   get_func = getUInt16BE;   put_func = putUInt16BE;   
+                                   load_func = load_BE<guint16>;        store_func = store_BE<guint16>;        return;
+        case DataType::Int32LE:    get_func = getInt32LE;    put_func = putInt32LE;    
+                                   load_func = load_LE<gint32>;         store_func = store_LE<gint32>;         return;
+        case DataType::UInt32LE:   get_func = getUInt32LE;   put_func = putUInt32LE;   
+                                   load_func = load_LE<guint32>;        store_func = store_LE<guint32>;        return;
+        case DataType::Int32BE:    get_func = getInt32BE;    put_func = putInt32BE;    
+                                   load_func = load_BE<gint32>;         store_func = store_BE<gint32>;         return;
+        case DataType::UInt32BE:   get_func = getUInt32BE;   put_func = putUInt32BE;   
+                                   load_func = load_BE<guint32>;        store_func = store_BE<guint32>;        return;
+        case DataType::Float16LE:  get_func = getFloat16LE;  put_func = putFloat16LE;  
+                                   load_func = load_float16<false>;     store_func = store_float16<false>;     return;
+        case DataType::Float16BE:  get_func = getFloat16BE;  put_func = putFloat16BE;  
+                                   load_func = load_float16<true>;      store_func = store_float16<true>;      return;
+        case DataType::Float32LE:  get_func = getFloat32LE;  put_func = putFloat32LE;  
+                                   load_func = load_LE<float32>;        store_func = store_LE<float32>;        return;
+        case DataType::Float32BE:  get_func = getFloat32BE;  put_func = putFloat32BE;  
+                                   load_func = load_BE<float32>;        store_func = store_BE<float32>;        return;
+        case DataType::Float64LE:  get_func = getFloat64LE;  put_func = putFloat64LE;  
+                                   load_func = load_LE<float64>;        store_func = store_LE<float64>;        return;
+        case DataType::Float64BE:  get_func = getFloat64BE;  put_func = putFloat64BE;  
+                                   load_func = load_BE<float64>;        store_func = store_BE<float64>;        return;
+        default: throw Exception ("invalid data type in image header");
+      }
+    }
+
 
 
 
@@ -286,9 +692,16 @@ namespace MR {
       if (dmap.optimised) stream << " (optimised)";
       stream << ":\n  segment size = " << dmap.segsize << "\n  ";
       if (!dmap.segment) stream << "(unmapped)\n";
-      else if (dmap.mem) stream << "in memory at " << (void*) dmap.mem << "\n";
+      else if (dmap.mem) stream << ( dmap.shared ? "shared " : "" ) << "in memory at " << (void*) dmap.mem << "\n";
+      else if (dmap.sparse) stream << "sparse: " << *dmap.sparse << "\n";
+      else if (dmap.slabs) stream << "streamed: " << *dmap.slabs << "\n";
+      else if (dmap.max_mapped) stream << "mapped on demand (" << dmap.mapped.size() << " of at most " << dmap.max_mapped << " files currently mapped)\n";
       stream << "files:\n";
       for (guint i = 0; i < dmap.list.size(); i++) {
+      if (dmap.list[i].gzfilename.size()) {
+        stream << "    " << dmap.list[i].gzfilename << ", offset " << dmap.list[i].offset << " (compressed)\n";
+        continue;
+      }
       stream << "    " << dmap.list[i].fmap.name() << ", offset " << dmap.list[i].offset << " (";
       if (dmap.list[i].fmap.is_mapped()) stream << "mapped at " << dmap.list[i].fmap.address();
       else stream << "unmapped";
@@ -310,6 +723,8 @@ namespace MR {
   float32 Mapper::getUInt32LE  (const void* data, gsize i)  { return (getLE<guint32> (data, i)); }
   float32 Mapper::getInt32BE   (const void* data, gsize i)  { return (getBE<gint32>  (data, i)); }
   float32 Mapper::getUInt32BE  (const void* data, gsize i)  { return (getBE<guint32> (data, i)); }
+  float32 Mapper::getFloat16LE (const void* data, gsize i)  { return (half_to_float (getLE<guint16> (data, i))); }
+  float32 Mapper::getFloat16BE (const void* data, gsize i)  { return (half_to_float (getBE<guint16> (data, i))); }
   float32 Mapper::getFloat32LE (const void* data, gsize i)  { return (getLE<float32> (data, i)); }
   float32 Mapper::getFloat32BE (const void* data, gsize i)  { return (getBE<float32> (data, i)); }
   float32 Mapper::getFloat64LE (const void* data, gsize i)  { return (getLE<float64> (data, i)); }
@@ -326,6 +741,8 @@ namespace MR {
   void Mapper::putUInt32LE  (float32 val, void* data, gsize i) { putLE<guint32> (guint32(val), data, i); }
   void Mapper::putInt32BE   (float32 val, void* data, gsize i) { putBE<gint32>  (gint32(val), data, i); }
   void Mapper::putUInt32BE  (float32 val, void* data, gsize i) { putBE<guint32> (guint32(val), data, i); }
+  void Mapper::putFloat16LE (float32 val, void* data, gsize i) { putLE<guint16> (float_to_half (val), data, i); }
+  void Mapper::putFloat16BE (float32 val, void* data, gsize i) { putBE<guint16> (float_to_half (val), data, i); }
   void Mapper::putFloat32LE (float32 val, void* data, gsize i) { putLE<float32> (float32(val), data, i); }
   void Mapper::putFloat32BE (float32 val, void* data, gsize i) { putBE<float32> (float32(val), data, i); }
   void Mapper::putFloat64LE (float32 val, void* data, gsize i) { putLE<float64> (float64(val), data, i); }
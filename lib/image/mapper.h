@@ -23,10 +23,14 @@
 #ifndef __image_mapper_h__
 #define __image_mapper_h__
 
+#include <glibmm/thread.h>
+
 #include "data_type.h"
 #include "file/mmap.h"
 #include "image/header.h"
 #include "image/format/base.h"
+#include "image/sparse.h"
+#include "image/slab_stream.h"
 #include "math/complex_number.h"
 
 namespace MR {
@@ -41,9 +45,11 @@ namespace MR {
         void                   reset ();
         void                   add (const String& filename, gsize offset = 0, gsize desired_size_if_inexistant = 0);
         void                   add (const File::MMap& fmap, gsize offset = 0);
-        void                   add_gz (const String& filename, const String& gz_filename, gsize offset = 0, gsize desired_size_if_inexistant = 0);
-        void                   add_gz (const File::MMap& fmap, const String& gz_filename, gsize offset = 0);
+        void                   add_gz (const String& gz_filename, gsize offset);
+        void                   add_gz (const String& gz_filename, const std::vector<guint8>& header);
         void                   add (guint8* memory_buffer);
+        void                   add (Sparse* sparse_data);
+        void                   share (const Mapper& parent);
 
 
         float32                re (gsize offset) const;
@@ -54,11 +60,6 @@ namespace MR {
         void                   set_temporary (bool temp);
         String                 output_name;
 
-
-
-        static void gzip (const String& original, const String& gzfile);
-        static String gunzip (const String& gzfile, const char* suffix);
-
       protected:
         Mapper ();
         ~Mapper ();
@@ -69,6 +70,7 @@ namespace MR {
             gsize    offset;
             guint8*    start () const;
             String gzfilename;
+            std::vector<guint8> gzheader;
             friend std::ostream& operator<< (std::ostream& stream, const Entry& m)
             {
               stream << "Mapper::Entry: offset = " << m.offset << ", " << m.fmap;
@@ -80,16 +82,43 @@ namespace MR {
         guint8*               mem;
         guint8**              segment;
         gsize                 segsize;
+        Sparse*               sparse;
+        SlabStream*           slabs;
+
+        guint                 max_mapped;
+        mutable std::vector<guint> mapped;
+        mutable std::vector<gsize> last_used;
+        mutable gsize         access_count, current;
+        mutable Glib::Thread* owner;
+        mutable bool          multithreaded;
+        mutable Glib::Mutex   mutex;
 
-        bool                  optimised, temporary, files_new;
+        const Mapper*         shared;
+        bool                  optimised, temporary, files_new, streaming;
 
         void                  set_data_type (DataType dt);
         void                  set_read_only (bool read_only);
 
         Entry&                operator[] (guint index);
+        guint8*               get_segment (gsize nseg) const;
+        guint8*               get_writable_segment (gsize nseg);
+        void                  map_segment (guint nseg) const;
+        void                  acquire_segment (gsize nseg) const;
+        void                  map_file (gsize nseg) const;
+        void                  map_slab (gsize nseg) const;
+        void                  modify_segment (guint nseg);
+        bool                  is_compressed () const { return (list.size() && list[0].gzfilename.size()); }
+        void                  load_gz (const Header& H, const Entry& entry, guint8* dest, gsize nelements) const;
+        void                  write_gz (const Header& H, const Entry& entry, const guint8* src, gsize nelements) const;
+        bool                  map_slabs (const Header& H);
         
         float32                (*get_func) (const void* data, gsize i);
         void                   (*put_func) (float32 val, void* data, gsize i);
+        void                   (*load_func) (const void* data, float32* dest, gsize first, gsize count);
+        void                   (*store_func) (const float32* src, void* data, gsize first, gsize count);
+
+        void                   load (const void* data, float32* dest, gsize count) const;
+        void                   store (const float32* src, void* data, gsize count) const;
 
         static float32         getBit       (const void* data, gsize i);
         static float32         getInt8      (const void* data, gsize i);
@@ -102,6 +131,8 @@ namespace MR {
         static float32         getUInt32LE  (const void* data, gsize i);
         static float32         getInt32BE   (const void* data, gsize i);
         static float32         getUInt32BE  (const void* data, gsize i);
+        static float32         getFloat16LE (const void* data, gsize i);
+        static float32         getFloat16BE (const void* data, gsize i);
         static float32         getFloat32LE (const void* data, gsize i);
         static float32         getFloat32BE (const void* data, gsize i);
         static float32         getFloat64LE (const void* data, gsize i);
@@ -118,6 +149,8 @@ namespace MR {
         static void            putUInt32LE  (float32 val, void* data, gsize i);
         static void            putInt32BE   (float32 val, void* data, gsize i);
         static void            putUInt32BE  (float32 val, void* data, gsize i);
+        static void            putFloat16LE (float32 val, void* data, gsize i);
+        static void            putFloat16BE (float32 val, void* data, gsize i);
         static void            putFloat32LE (float32 val, void* data, gsize i);
         static void            putFloat32BE (float32 val, void* data, gsize i);
         static void            putFloat64LE (float32 val, void* data, gsize i);
@@ -127,6 +160,7 @@ namespace MR {
         void                   map (const Header& H);
         void                   unmap (const Header& H);
         bool                   is_mapped () const { return (segment); }
+        float32*               data () const { return (optimised && segment ? (float32*) segment[0] : NULL); }
 
 
         friend class Object;
@@ -154,11 +188,22 @@ namespace MR {
       mem (NULL),
       segment (NULL),
       segsize (0),
+      sparse (NULL),
+      slabs (NULL),
+      max_mapped (0),
+      access_count (0),
+      current (G_MAXSIZE),
+      owner (NULL),
+      multithreaded (false),
+      shared (NULL),
       optimised (false),
       temporary (false),
       files_new (true),
+      streaming (false),
       get_func (NULL),
-      put_func (NULL)
+      put_func (NULL),
+      load_func (NULL),
+      store_func (NULL)
     { 
     }
 
@@ -172,13 +217,26 @@ namespace MR {
       segsize = 0; 
       get_func = NULL;
       put_func = NULL;
-      optimised = temporary = false;
+      load_func = NULL;
+      store_func = NULL;
+      optimised = temporary = streaming = false;
       files_new = true;
       output_name.clear();
-      delete [] mem;
+      if (!shared) delete [] mem;
+      shared = NULL;
       delete [] segment;
       mem = NULL;
       segment = NULL;
+      delete sparse;
+      sparse = NULL;
+      delete slabs;
+      slabs = NULL;
+      max_mapped = 0;
+      mapped.clear();
+      last_used.clear();
+      current = G_MAXSIZE;
+      owner = NULL;
+      multithreaded = false;
     }
 
 
@@ -217,27 +275,73 @@ namespace MR {
 
 
 
-    inline void Mapper::add_gz (const String& filename, const String& gz_filename, gsize offset, gsize desired_size_if_inexistant)
+    /** \brief add a compressed file to the list.
+     *
+     * The data will be decompressed straight into memory when the image is
+     * mapped, starting \a offset bytes into the uncompressed stream. */
+    inline void Mapper::add_gz (const String& gz_filename, gsize offset)
     {
-      add (filename, offset, desired_size_if_inexistant);
-      list.back().gzfilename = gz_filename;
+      Entry entry;
+      entry.gzfilename = gz_filename;
+      entry.offset = offset;
+      files_new = false;
+      list.push_back (entry);
     }
 
+    /** \brief add a new compressed file to the list.
+     *
+     * The data will be held in memory, and written out following \a header
+     * in compressed form when the image is unmapped. */
+    inline void Mapper::add_gz (const String& gz_filename, const std::vector<guint8>& header)
+    {
+      Entry entry;
+      entry.gzfilename = gz_filename;
+      entry.gzheader = header;
+      entry.offset = header.size();
+      list.push_back (entry);
+    }
 
 
-    inline void Mapper::add_gz (const File::MMap& fmap, const String& gz_filename, gsize offset)
+    inline void Mapper::add (guint8* memory_buffer)
     {
-      add (fmap, offset);
-      list.back().gzfilename = gz_filename;
+      assert (mem == NULL);
+      assert (list.size() == 0);
+      mem = memory_buffer;
     }
 
 
+    /** \brief access the data through the block-sparse store \a sparse_data.
+     *
+     * The Mapper takes ownership of \a sparse_data. Blocks are then read
+     * from file as they are accessed, rather than mapped up front. */
+    inline void Mapper::add (Sparse* sparse_data)
+    {
+      if (mem || list.size() || sparse) {
+        delete sparse_data;
+        throw Exception ("sparse images cannot be combined into a single data set");
+      }
+      sparse = sparse_data;
+    }
 
-    inline void Mapper::add (guint8* memory_buffer)
+
+    /** \brief access the data held in memory by \a parent.
+     *
+     * The memory buffer is not owned by this Mapper: it is that of \a parent
+     * at the time this Mapper is mapped, and is released again when it is
+     * unmapped. \a parent must therefore be mapped first, and remain so for
+     * as long as this Mapper is mapped. */
+    inline void Mapper::share (const Mapper& parent)
     {
       assert (mem == NULL);
       assert (list.size() == 0);
-      mem = memory_buffer;
+      assert (parent.mem);
+      optimised = parent.optimised;
+      get_func = parent.get_func;
+      put_func = parent.put_func;
+      load_func = parent.load_func;
+      store_func = parent.store_func;
+      files_new = false;
+      shared = &parent;
     }
 
 
@@ -255,8 +359,9 @@ namespace MR {
     {
       for (guint s = 0; s < list.size(); s++) {
         list[s].fmap.set_read_only (read_only); 
-        if (segment) segment[s] = list[s].start();
+        if (segment) segment[s] = list[s].fmap.is_mapped() ? list[s].start() : NULL;
       }
+      if (sparse) sparse->set_read_only (read_only);
     }
 
 
@@ -268,12 +373,53 @@ namespace MR {
 
 
 
+    /** \brief return the address of segment \a nseg, mapping it if necessary.
+     *
+     * When the image is split over more files than can be mapped at once,
+     * each file is only mapped the first time it is accessed, and the least
+     * recently used file is unmapped to make room for it. The first thread
+     * to access the data owns the segment it last switched to, which can
+     * then be accessed without locking. As soon as a second thread accesses
+     * the data, files are no longer unmapped once mapped, since another
+     * thread may still be using them.
+     *
+     * For sparse images, each segment corresponds to a block of the sparse
+     * store, which is likewise only read the first time it is accessed. 
+     *
+     * For compressed images accessed in streaming mode, each segment
+     * corresponds to a slab of the image, which is decompressed when it is
+     * accessed, and may later be discarded to make room for the least
+     * recently used ones. The same rules apply: slabs are no longer
+     * discarded once a second thread has accessed the data. */
+    inline guint8* Mapper::get_segment (gsize nseg) const
+    {
+      if (max_mapped || slabs) {
+        if (multithreaded ? !segment[nseg] : ( nseg != current || Glib::Thread::self() != owner ))
+          acquire_segment (nseg);
+      }
+      else if (sparse && !segment[nseg]) map_segment (nseg);
+      return (segment[nseg]);
+    }
+
+
+    /** \brief return the address of segment \a nseg, ready to be modified.
+     *
+     * This only differs from get_segment() for sparse images, where blocks
+     * that have not yet been modified may be shared or held in the file. */
+    inline guint8* Mapper::get_writable_segment (gsize nseg)
+    {
+      if (sparse && !sparse->is_modified (nseg)) modify_segment (nseg);
+      return (get_segment (nseg));
+    }
+
+
+
 
     inline float32 Mapper::re (gsize offset) const 
     {
       if (optimised) return (((float32*) segment[0])[offset]);
       gssize nseg (offset/segsize);
-      return (get_func (segment[nseg], offset - nseg*segsize)); 
+      return (get_func (get_segment (nseg), offset - nseg*segsize)); 
     }
 
 
@@ -284,7 +430,7 @@ namespace MR {
     { 
       if (optimised) ((float32*) segment[0])[offset] = val;
       gssize nseg (offset/segsize);
-      put_func (val, segment[nseg], offset - nseg*segsize); 
+      put_func (val, get_writable_segment (nseg), offset - nseg*segsize); 
     }
 
 
@@ -295,7 +441,7 @@ namespace MR {
     { 
       if (optimised) return (((float32*) segment[0])[offset+1]);
       gssize nseg (offset/segsize);
-      return (get_func (segment[nseg], offset - nseg*segsize + 1)); 
+      return (get_func (get_segment (nseg), offset - nseg*segsize + 1)); 
     }
 
 
@@ -305,7 +451,7 @@ namespace MR {
     { 
       if (optimised) ((float32*) segment[0])[offset+1] = val;
       gssize nseg (offset/segsize);
-      put_func (val, segment[nseg], offset - nseg*segsize + 1); 
+      put_func (val, get_writable_segment (nseg), offset - nseg*segsize + 1); 
     }
 
 
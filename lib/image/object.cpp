@@ -189,6 +189,8 @@ namespace MR {
       M.optimised = false;
 
       Image::Object& ref (*images[0]);
+      for (std::vector<RefPtr<Object> >::iterator it = images.begin(); it != images.end(); ++it) 
+        if (*it && (*it)->M.sparse) throw Exception ("cannot concatenate images: not supported for sparse images");
       for (std::vector<RefPtr<Object> >::iterator it = images.begin()+1; it != images.end(); ++it) {
         if (!*it) throw Exception ("cannot concatenate images: some images are NULL");
         Image::Object& ima (**it);
@@ -233,6 +235,210 @@ namespace MR {
 
 
 
+    /** \brief set up this image as a view of (part of) \a parent.
+     *
+     * No data are copied: the view accesses the data of \a parent directly,
+     * through its own start offset and strides. The voxels included along
+     * each axis of \a parent are those at positions from[n] + i*step[n],
+     * for i = 0 ... size[n]-1; a negative step flips the axis. Any of these
+     * vectors can be left empty, in which case the whole extent of each axis
+     * is used. Axis \a n of the view corresponds to axis axes[n] of the
+     * parent; the first three (spatial) axes can only be permuted amongst
+     * themselves. 
+     *
+     * The parent image is mapped. If its data are then held in memory, the
+     * view uses the same buffer, and the parent must remain in scope (and
+     * mapped) for as long as the view is mapped; otherwise, the view maps
+     * the parent's files independently. */
+    void Object::view (Object& parent, const std::vector<int>& from, const std::vector<int>& step, 
+        const std::vector<int>& size, const std::vector<guint>& axes)
+    {
+      M.reset();
+      parent.map();
+      const Header& P (parent.H);
+      debug ("creating view of image \"" + P.name + "\"...");
+      if (parent.M.sparse) throw Exception ("cannot create view of image \"" + P.name + "\": not supported for sparse images");
+
+      const int nd = P.ndim();
+      const int nspatial = MIN (nd, 3);
+      if ((from.size() && from.size() != guint (nd)) || (step.size() && step.size() != guint (nd)) || 
+          (size.size() && size.size() != guint (nd)) || (axes.size() && axes.size() != guint (nd)))
+        throw Exception ("cannot create view of image \"" + P.name + "\": number of axes do not match");
+
+      std::vector<guint> order (nd);
+      std::vector<bool> used (nd, false);
+      for (int n = 0; n < nd; n++) {
+        order[n] = axes.size() ? axes[n] : n;
+        if (order[n] >= guint (nd) || used[order[n]] || ( n < nspatial ) != ( int (order[n]) < nspatial ))
+          throw Exception ("cannot create view of image \"" + P.name + "\": invalid axis permutation");
+        used[order[n]] = true;
+      }
+
+      H = P;
+      H.read_only = P.read_only;
+      start = parent.start;
+      gssize view_stride[MRTRIX_MAX_NDIMS];
+      Math::Matrix T (P.transform());
+
+      for (int p = 0; p < nd; p++) {
+        int f = from.size() ? from[p] : 0;
+        int s = step.size() ? step[p] : 1;
+        if (s == 0 || f < 0 || f >= P.dim(p)) 
+          throw Exception ("cannot create view of image \"" + P.name + "\": invalid start position or step size for axis " + str (p));
+        int d = size.size() ? size[p] : ( s > 0 ? ( P.dim(p) - 1 - f ) / s + 1 : f / (-s) + 1 );
+        int last = f + (d-1)*s;
+        if (d < 1 || last < 0 || last >= P.dim(p)) 
+          throw Exception ("cannot create view of image \"" + P.name + "\": selection out of bounds for axis " + str (p));
+
+        start += gssize (f) * parent.stride[p];
+        if (p < nspatial) 
+          for (guint r = 0; r < 3; r++) 
+            T(r,3) += f * P.axes.vox[p] * P.transform()(r,p);
+
+        for (int n = 0; n < nd; n++) {
+          if (order[n] != guint (p)) continue;
+          H.axes.dim[n] = d;
+          H.axes.vox[n] = P.axes.vox[p] * abs (s);
+          H.axes.desc[n] = P.axes.desc[p];
+          H.axes.units[n] = P.axes.units[p];
+          H.axes.axis[n] = P.axes.axis[p];
+          H.axes.forward[n] = s > 0 ? P.axes.forward[p] : !P.axes.forward[p];
+          view_stride[n] = s * parent.stride[p];
+          if (n < nspatial) 
+            for (guint r = 0; r < 3; r++) 
+              T(r,n) = ( s > 0 ? 1.0 : -1.0 ) * P.transform()(r,p);
+        }
+      }
+
+      // the header may re-order and flip the spatial axes to keep them as
+      // close as possible to the scanner axes; the strides need to follow:
+      H.set_transform (T);
+      memcpy (stride, view_stride, MRTRIX_MAX_NDIMS*sizeof(gssize));
+      for (int n = 0; n < nspatial; n++) {
+        int match = 0;
+        double best = 0.0;
+        for (int m = 0; m < nspatial; m++) {
+          double dot = 0.0;
+          for (guint r = 0; r < 3; r++) dot += H.transform()(r,n) * T(r,m);
+          if (fabs (dot) > fabs (best)) { best = dot; match = m; }
+        }
+        stride[n] = best < 0.0 ? -view_stride[match] : view_stride[match];
+        if (best < 0.0) start += view_stride[match] * gssize (H.axes.dim[n]-1);
+      }
+
+      if (parent.M.mem) M.share (parent.M);
+      else {
+        // map the files independently of the parent, so that unmapping either
+        // image (including when files are mapped on demand) leaves the
+        // other's mappings intact:
+        for (guint n = 0; n < parent.M.list.size(); n++) {
+          const Mapper::Entry& entry (parent.M.list[n]);
+          if (entry.gzfilename.size()) M.add_gz (entry.gzfilename, entry.offset);
+          else M.add (entry.fmap.name(), entry.offset);
+        }
+        M.set_read_only (H.read_only);
+        M.files_new = false;
+        M.set_data_type (H.data_type);
+        if (M.list.size() == 1 && H.data_type == DataType::Native) M.optimised = true;
+      }
+
+      if (App::log_level > 2) {
+        String string ("data increments initialised with start = " + str (start) + ", stride = [ ");
+        for (int i = 0; i < ndim(); i++) string += str (stride[i]) + " "; 
+        debug (string + "]");
+      }
+    }
+
+
+
+
+
+    /** \brief find how the image data are laid out within a single file.
+     *
+     * If the voxels of this image are stored contiguously within a single
+     * uncompressed file, with no gaps (as is always the case for an image
+     * opened directly, but not necessarily for a view), this sets the \a
+     * file_axes layout specifiers and returns the name of the \a file and
+     * the \a offset in bytes to the first voxel in that file.
+     * \return false if the data cannot be described in this way. */
+    bool Object::layout (Axes& file_axes, String& file, gsize& offset) const
+    {
+      if (M.list.size() != 1 || M.mem || M.is_compressed() || H.data_type.bits() < 8) return (false);
+
+      const gssize components = H.data_type.is_complex() ? 2 : 1;
+      std::vector<guint> order;
+      for (int n = 0; n < ndim(); n++) 
+        if (dim(n) > 1) order.push_back (n);
+      for (guint i = 1; i < order.size(); i++) 
+        for (guint j = i; j > 0 && labs (stride[order[j]]) < labs (stride[order[j-1]]); j--) 
+          std::swap (order[j], order[j-1]);
+
+      gssize expected = components;
+      gssize first = start;
+      for (guint i = 0; i < order.size(); i++) {
+        if (labs (stride[order[i]]) != expected) return (false);
+        expected *= dim (order[i]);
+        if (stride[order[i]] < 0) first += stride[order[i]] * gssize (dim (order[i])-1);
+      }
+
+      file_axes = H.axes;
+      guint next = order.size();
+      for (int n = 0; n < ndim(); n++) {
+        file_axes.axis[n] = next;
+        file_axes.forward[n] = true;
+      }
+      for (guint i = 0; i < order.size(); i++) {
+        file_axes.axis[order[i]] = i;
+        file_axes.forward[order[i]] = stride[order[i]] > 0;
+      }
+      for (int n = 0; n < ndim(); n++) 
+        if (dim(n) == 1) file_axes.axis[n] = next++;
+
+      file = M.list[0].fmap.name();
+      offset = M.list[0].offset + gsize (first) * H.data_type.bytes() / components;
+      return (true);
+    }
+
+
+
+
+
+
+
+    void Object::stream ()
+    {
+      std::vector<int> order (ndim());
+      for (int n = 0; n < ndim(); n++) order[n] = n;
+      stream (order);
+    }
+
+
+
+
+    void Object::stream (const std::vector<int>& order)
+    {
+      // any access to an earlier part of a compressed image requires the file
+      // to be decompressed again from the start, so streaming is only worth
+      // it if the data are accessed in the order they are stored:
+      assert (order.size() == guint (ndim()));
+      gssize last = 0;
+      for (guint n = 0; n < order.size(); n++) {
+        if (dim (order[n]) < 2) continue;
+        if (stride[order[n]] <= last) {
+          debug ("image \"" + name() + "\" is not accessed in the order it is stored - it will not be streamed");
+          return;
+        }
+        last = stride[order[n]];
+      }
+      M.streaming = true;
+    }
+
+
+
+
+
+
+
     void Object::setup ()
     {
       if (H.name == "-") H.name = M.list[0].fmap.name();
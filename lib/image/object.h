@@ -53,6 +53,9 @@ namespace MR {
         void                 open (const String& imagename, bool is_read_only = true);
         void                 create (const String& imagename, Header &template_header);
         void                 concatenate (std::vector<RefPtr<Object> >& images);
+        void                 view (Object& parent, const std::vector<int>& from, const std::vector<int>& step, 
+                                   const std::vector<int>& size, const std::vector<guint>& axes = std::vector<guint>());
+        bool                 layout (Axes& file_axes, String& file, gsize& offset) const;
 
         void                 map ()                  { if (!is_mapped()) M.map (H); }
         void                 unmap ()                { if (is_mapped()) M.unmap (H); }
@@ -109,6 +112,32 @@ namespace MR {
 
         void                 optimise () { M.optimised = true; }
 
+        //! declare that the image data will be accessed in order, in a single pass
+        /*! This must be called before the image is mapped, and allows images
+         * larger than the available RAM to be processed: rather than being
+         * loaded into memory up front, the data are then read from file as
+         * they are accessed. For compressed images, the data are decompressed
+         * one slab at a time along the slowest axis (see the StreamBufferSize
+         * config file entry). Access to earlier parts of the image remains
+         * possible, but may be slow.
+         *
+         * The image is assumed to be accessed with axis 0 varying fastest,
+         * then axis 1, etc. Streaming is only enabled if this matches the
+         * order in which the data are stored; otherwise, the image is
+         * accessed as usual. */
+        void                 stream ();
+
+        //! as stream(), for an image accessed with the axes in \a order varying from fastest to slowest
+        void                 stream (const std::vector<int>& order);
+
+        //! direct access to the image data, if held in memory as float32
+        /*! This is only available if optimise() was called before the image
+         * was mapped; otherwise NULL is returned. The value at a given offset
+         * (see Position::getoffset()) is then data()[offset], before scaling
+         * by scale() and offset(). This allows hot loops to bypass the usual
+         * per-voxel data type handling entirely. */
+        float32*             data () const { return (M.data()); }
+
         friend std::ostream& operator<< (std::ostream& stream, const Object& obj);
 
       protected:
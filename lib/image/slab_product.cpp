@@ -0,0 +1,187 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <gsl/gsl_blas.h>
+
+#include "image/slab_product.h"
+#include "image/position.h"
+
+// the approximate number of voxels processed in each call to gsl_blas_dgemm():
+#define SLAB_PRODUCT_VOXELS 4096
+
+namespace MR {
+  namespace Image {
+
+    namespace {
+
+      // fetch the values of the voxel at the current position, returns false
+      // if the result would not be finite (unless non-finite values are to
+      // be substituted):
+      inline bool gather (Position& in, guint axis, const std::vector<int>& vols, const std::vector<int>& norm_vols, bool clamp, bool use_log, bool substitute, double* x)
+      {
+        double norm = 1.0;
+        if (norm_vols.size()) {
+          norm = 0.0;
+          for (guint n = 0; n < norm_vols.size(); n++) {
+            in.set (axis, norm_vols[n]);
+            norm += in.value();
+          }
+          norm /= norm_vols.size();
+          if (!gsl_finite (norm) || norm == 0.0) return (false);
+        }
+
+        for (guint n = 0; n < vols.size(); n++) {
+          in.set (axis, vols[n]);
+          double val = in.value();
+          if (!gsl_finite (val)) {
+            if (!substitute) return (false);
+            x[n] = 1e-12;
+            continue;
+          }
+          if (clamp && val < 0.0) val = 0.0;
+          val /= norm;
+          if (use_log) val = val > 0.0 ? -log (val) : 1e-12;
+          x[n] = val;
+        }
+
+        return (true);
+      }
+
+    }
+
+
+
+
+    SlabProduct::SlabProduct (Object& input, Object& output, const Math::Matrix& transform, guint volume_axis) :
+      in_obj (input), out_obj (output), mask_obj (NULL), M (transform), axis (volume_axis), clamp (false), use_log (false), substitute (false), rows_per_slab (1) { }
+
+
+
+
+    void SlabProduct::run (const String& message)
+    {
+      if (vols.empty())
+        for (int n = 0; n < in_obj.dim (axis); n++)
+          vols.push_back (n);
+
+      for (guint n = 0; n < vols.size(); n++)
+        if (vols[n] < 0 || vols[n] >= in_obj.dim (axis))
+          throw Exception ("volume index out of bounds for image \"" + in_obj.name() + "\"");
+      for (guint n = 0; n < norm_vols.size(); n++)
+        if (norm_vols[n] < 0 || norm_vols[n] >= in_obj.dim (axis))
+          throw Exception ("volume index out of bounds for image \"" + in_obj.name() + "\"");
+
+      if (M.columns() != vols.size() || M.rows() < (guint) out_obj.dim(3))
+        throw Exception ("transform matrix dimensions do not match images \"" + in_obj.name() + "\" and \"" + out_obj.name() + "\"");
+      for (std::map<int,Math::Matrix>::const_iterator i = slice_M.begin(); i != slice_M.end(); ++i)
+        if (i->second.columns() != M.columns() || i->second.rows() != M.rows())
+          throw Exception ("transform matrix dimensions for slice " + str(i->first) + " do not match");
+
+      for (guint n = 0; n < 3; n++) {
+        if (out_obj.dim(n) != in_obj.dim(n) || ( mask_obj && mask_obj->dim(n) != in_obj.dim(n) ))
+          throw Exception ("dimensions of images \"" + in_obj.name() + "\" and \"" + out_obj.name() + "\" do not match");
+      }
+
+      in_obj.map();
+      out_obj.map();
+      if (mask_obj) mask_obj->map();
+
+      rows_per_slab = MAX (1, SLAB_PRODUCT_VOXELS / in_obj.dim(0));
+      gsize num_rows = in_obj.dim(1) * in_obj.dim(2);
+      loop = new Thread::Loop (num_rows, rows_per_slab);
+
+      ProgressBar::init (num_rows, message);
+      Thread::run (*this);
+      progress.update();
+      ProgressBar::done();
+    }
+
+
+
+
+    void SlabProduct::execute ()
+    {
+      Position in (in_obj);
+      Position out (out_obj);
+      Ptr<Position> mask;
+      if (mask_obj) mask = new Position (*mask_obj);
+
+      const guint nin = vols.size(), nout = out.dim(3);
+      const gsize max_voxels = rows_per_slab * in.dim(0);
+      Math::Matrix X (max_voxels, nin), Y (max_voxels, nout);
+      std::vector<int> slab_x (max_voxels);
+      std::vector<gsize> slab_row (max_voxels);
+      gsize first, last;
+
+      while (loop->next (first, last)) {
+        gsize row = first;
+        while (row < last) {
+
+          // gather the voxels from as many rows as share the same transform:
+          const Math::Matrix& T (transform (row / in.dim(1)));
+          gsize n = 0;
+          for (; row < last && &transform (row / in.dim(1)) == &T; row++) {
+            in.set (1, row % in.dim(1)); in.set (2, row / in.dim(1));
+            out.set (1, in[1]); out.set (2, in[2]);
+            if (mask) { mask->set (1, in[1]); mask->set (2, in[2]); }
+
+            for (in.set(0,0), out.set(0,0); in[0] < in.dim(0); in.inc(0), out.inc(0)) {
+              if (mask) {
+                mask->set (0, in[0]);
+                if (mask->value() < 0.5) continue;
+              }
+
+              if (gather (in, axis, vols, norm_vols, clamp, use_log, substitute, &X(n,0))) {
+                slab_x[n] = in[0];
+                slab_row[n] = row;
+                n++;
+              }
+              else {
+                for (out.set(3,0); out[3] < out.dim(3); out.inc(3))
+                  out.value (GSL_NAN);
+              }
+            }
+          }
+
+          if (!n) continue;
+
+          gsl_matrix_view x = gsl_matrix_submatrix (X.get_gsl_matrix(), 0, 0, n, nin);
+          gsl_matrix_view y = gsl_matrix_submatrix (Y.get_gsl_matrix(), 0, 0, n, nout);
+          gsl_matrix_const_view t = gsl_matrix_const_submatrix (T.get_gsl_matrix(), 0, 0, nout, nin);
+          gsl_blas_dgemm (CblasNoTrans, CblasTrans, 1.0, &x.matrix, &t.matrix, 0.0, &y.matrix);
+
+          for (gsize i = 0; i < n; i++) {
+            out.set (0, slab_x[i]);
+            out.set (1, slab_row[i] % out.dim(1));
+            out.set (2, slab_row[i] / out.dim(1));
+            for (out.set(3,0); out[3] < out.dim(3); out.inc(3))
+              out.value (Y(i, out[3]));
+          }
+        }
+
+        progress.inc (last - first);
+      }
+    }
+
+  }
+}
+
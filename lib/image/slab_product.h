@@ -0,0 +1,118 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef __image_slab_product_h__
+#define __image_slab_product_h__
+
+#include <map>
+#include "ptr.h"
+#include "thread.h"
+#include "math/matrix.h"
+#include "image/object.h"
+
+namespace MR {
+  namespace Image {
+
+    //! apply a fixed linear transform to the values of each voxel
+    /*! For every voxel of the \a input image, the values along the volume
+     * axis are multiplied by the \a transform matrix, and the result is
+     * written along axis 3 of the \a output image. This is what is needed to
+     * fit a linear model independently at each voxel, as done for example
+     * when computing the spherical harmonic coefficients of DW signals.
+     *
+     * Rather than performing one small matrix-vector product per voxel, the
+     * values of a slab of voxels are gathered into a matrix with one row per
+     * voxel, which is multiplied by the transform in a single call to
+     * gsl_blas_dgemm(), and the results are then scattered back into the
+     * output image. Slabs are processed concurrently by Thread::number()
+     * threads.
+     *
+     * Only the first output.dim(3) rows of the transform are used, so that
+     * its size need not match the output exactly (e.g. to discard the
+     * b=0 term of the tensor fit). Voxels outside the mask (if supplied) are
+     * left untouched. Voxels containing non-finite values (unless
+     * set_substitute_non_finite() is used), or whose normalisation is zero
+     * or non-finite, are set to NaN in the output. */
+    class SlabProduct {
+      public:
+        //! the values along \a axis of \a input will be multiplied by \a transform
+        SlabProduct (Object& input, Object& output, const Math::Matrix& transform, guint axis = 3);
+
+        //! only use these input volumes, in this order
+        /*! By default, all volumes along the axis are used. */
+        void set_volumes (const std::vector<int>& volumes)  { vols = volumes; }
+
+        //! only process voxels where the \a mask image is 0.5 or more
+        void set_mask (Object& mask)                         { mask_obj = &mask; }
+
+        //! divide the values by the mean of the \a reference volumes
+        /*! This is done after the negative values have been clamped, and
+         * before the log is taken. */
+        void set_normalisation (const std::vector<int>& reference) { norm_vols = reference; }
+
+        //! set negative values to zero before applying the transform
+        void set_clamp_negative (bool yesno = true)           { clamp = yesno; }
+
+        //! replace each value S by -log(S) before applying the transform
+        /*! Values that are zero or negative are replaced by 1e-12 instead. */
+        void set_log (bool yesno = true)                      { use_log = yesno; }
+
+        //! replace non-finite values by 1e-12, rather than discarding the voxel
+        /*! The value is substituted as is, i.e. after the log would have been
+         * taken. This matches how zero or negative values are handled by
+         * set_log(). */
+        void set_substitute_non_finite (bool yesno = true)    { substitute = yesno; }
+
+        //! use a different \a transform for axial slice \a slice
+        void set_slice_transform (int slice, const Math::Matrix& transform) { slice_M[slice] = transform; }
+
+        //! process the whole image, showing \a message on the ProgressBar
+        void run (const String& message);
+
+        void execute ();
+
+      protected:
+        Object& in_obj;
+        Object& out_obj;
+        Object* mask_obj;
+        Math::Matrix M;
+        std::map<int,Math::Matrix> slice_M;
+        guint axis;
+        std::vector<int> vols, norm_vols;
+        bool clamp, use_log, substitute;
+
+        guint rows_per_slab;
+        Ptr<Thread::Loop> loop;
+        Thread::Progress progress;
+
+        const Math::Matrix& transform (int slice) const
+        {
+          std::map<int,Math::Matrix>::const_iterator i = slice_M.find (slice);
+          return (i == slice_M.end() ? M : i->second);
+        }
+    };
+
+  }
+}
+
+#endif
+
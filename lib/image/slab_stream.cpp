@@ -0,0 +1,203 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "image/slab_stream.h"
+
+namespace MR {
+  namespace Image {
+
+    SlabStream::SlabStream (const std::vector<String>& filenames, const std::vector<gsize>& offsets, gsize slab_bytes, gsize nslabs, guint max_resident) :
+      files (filenames),
+      start (offsets),
+      bytes (slab_bytes),
+      per_file (nslabs),
+      max_slabs (max_resident < 2 ? 2 : max_resident),
+      access_count (0),
+      next (0),
+      prefetch (NULL),
+      ahead (NULL),
+      ahead_index (num_slabs()),
+      current (0),
+      slot (num_slabs(), G_MAXUINT)
+    {
+    }
+
+
+
+    SlabStream::~SlabStream ()
+    {
+      finish_read_ahead();
+      for (guint n = 0; n < resident.size(); n++) delete [] resident[n].data;
+      delete [] ahead;
+    }
+
+
+
+
+    guint8* SlabStream::slab (gsize n, std::vector<gsize>& discarded, bool keep)
+    {
+      discarded.clear();
+      if (slot[n] != G_MAXUINT) {
+        used (n);
+        return (resident[slot[n]].data);
+      }
+
+      finish_read_ahead();
+
+      // a failed read ahead is only reported if that slab is the one wanted
+      // now; otherwise, it will be read again when it is requested:
+      if (ahead_error.size()) {
+        String error (ahead_error);
+        bool wanted = ( ahead_index == n );
+        ahead_error.clear();
+        ahead_index = num_slabs();
+        if (wanted) throw Exception (error);
+      }
+
+      // when several threads are reading, slabs may not be requested in
+      // order. The slab read ahead is kept even if it is not the one wanted
+      // now, since it will most likely be needed shortly, and reading it
+      // again would mean decompressing the file from the start:
+      if (ahead && ahead_index < num_slabs() && ahead_index != n) {
+        guint i = make_room (discarded, keep);
+        std::swap (resident[i].data, ahead);
+        resident[i].index = ahead_index;
+        resident[i].last_used = ++access_count;
+        slot[ahead_index] = i;
+        ahead_index = num_slabs();
+      }
+
+      guint i = make_room (discarded, keep);
+      Entry& entry (resident[i]);
+      if (ahead && ahead_index == n) {
+        std::swap (entry.data, ahead);
+        ahead_index = num_slabs();
+      }
+      else {
+        if (!entry.data) entry.data = new guint8 [bytes];
+        seek (n);
+        zf.read (entry.data, bytes);
+        next = n+1;
+      }
+      entry.index = n;
+      entry.last_used = ++access_count;
+      slot[n] = i;
+
+      // decompress the next slab while this one is being processed:
+      if (n+1 < num_slabs() && slot[n+1] == G_MAXUINT) {
+        if (!ahead) ahead = new guint8 [bytes];
+        ahead_index = n+1;
+        prefetch = Glib::Thread::create (sigc::mem_fun (*this, &SlabStream::read_ahead), true);
+      }
+
+      return (entry.data);
+    }
+
+
+
+
+    // find an entry to hold a new slab, discarding the least recently used
+    // one if necessary. Its buffer is then overwritten in place, which is
+    // only safe since the Mapper does not hold on to the address of a
+    // discarded slab, and sets keep once another thread might still be
+    // reading it:
+    guint SlabStream::make_room (std::vector<gsize>& discarded, bool keep)
+    {
+      if (resident.size() < max_slabs || keep) {
+        Entry entry;
+        entry.data = NULL;
+        resident.push_back (entry);
+        return (resident.size()-1);
+      }
+
+      guint i = 0;
+      for (guint j = 1; j < resident.size(); j++)
+        if (resident[j].last_used < resident[i].last_used)
+          i = j;
+      discarded.push_back (resident[i].index);
+      slot[resident[i].index] = G_MAXUINT;
+      return (i);
+    }
+
+
+
+
+    void SlabStream::seek (gsize n)
+    {
+      String error = try_seek (n);
+      if (error.size()) throw Exception (error);
+    }
+
+
+
+    // the next slab read ahead is never behind the current position, so
+    // that the file is only ever rewound by the thread calling slab():
+    String SlabStream::try_seek (gsize n)
+    {
+      guint file = n / per_file;
+      if (zf.is_open() && current == file && next <= n) 
+        return (zf.try_skip ((n - next) * bytes));
+
+      if (zf.is_open() && current == file)
+        debug ("rewinding compressed image file \"" + files[file] + "\"");
+      current = file;
+      String error = zf.try_open (files[file]);
+      if (error.empty()) error = zf.try_skip (start[file] + (n % per_file) * bytes);
+      return (error);
+    }
+
+
+
+
+    // runs in the background: no Exception is constructed here, since it
+    // would be displayed straight away. Any error is recorded, and reported
+    // by slab() if that slab is requested.
+    void SlabStream::read_ahead ()
+    {
+      ahead_error = try_seek (ahead_index);
+      if (ahead_error.empty()) ahead_error = zf.try_read (ahead, bytes);
+      if (ahead_error.size()) zf.close();
+      else next = ahead_index+1;
+    }
+
+
+
+    void SlabStream::finish_read_ahead ()
+    {
+      if (!prefetch) return;
+      prefetch->join();
+      prefetch = NULL;
+    }
+
+
+
+
+    std::ostream& operator<< (std::ostream& stream, const SlabStream& S)
+    {
+      stream << S.files.size() << " compressed file(s), " << S.num_slabs() << " slabs of " << S.bytes
+        << " bytes, " << S.resident.size() << " of at most " << S.max_slabs << " held in memory";
+      return (stream);
+    }
+
+  }
+}
+
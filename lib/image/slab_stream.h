@@ -0,0 +1,108 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef __image_slab_stream_h__
+#define __image_slab_stream_h__
+
+#include <glibmm/thread.h>
+
+#include "file/gz.h"
+
+namespace MR {
+  namespace Image {
+
+    //! read-only access to compressed image data, one slab at a time
+    /*! The data are split into slabs of a fixed number of bytes, which are
+     * decompressed as they are accessed, so that images much larger than the
+     * available RAM can be processed in a single pass. At most a fixed number
+     * of slabs are held in memory at once, the least recently used being
+     * discarded to make room for the next one. Whenever a slab is read, the
+     * next one is decompressed in the background, so that the next slab is
+     * usually ready by the time it is needed. The memory used is therefore
+     * bounded by one more slab than the maximum number of resident slabs.
+     *
+     * The compressed stream can only be read forwards: accessing a slab that
+     * precedes the current position requires the file to be decompressed
+     * again from the start. This class is used by the Mapper, which is
+     * responsible for calling used() whenever a resident slab is accessed,
+     * and for serialising calls to slab(). Since the buffer of a discarded
+     * slab is reused for the next one, the Mapper stops slabs from being
+     * discarded as soon as more than one thread is reading them. */
+    class SlabStream {
+      public:
+        //! \a nslabs slabs of \a slab_bytes bytes will be read from each file, starting \a offsets[n] bytes into file \a filenames[n]
+        SlabStream (const std::vector<String>& filenames, const std::vector<gsize>& offsets, gsize slab_bytes, gsize nslabs, guint max_resident);
+        ~SlabStream ();
+
+        gsize         num_slabs () const { return (files.size()*per_file); }
+        guint         max_resident () const { return (max_slabs); }
+
+        //! the data for slab \a n
+        /*! The indices of any slabs that had to be discarded to make room for
+         * it are returned in \a discarded. If \a keep is set, no slabs are
+         * discarded, and more than max_resident() slabs may be held. */
+        guint8*       slab (gsize n, std::vector<gsize>& discarded, bool keep = false);
+
+        //! record an access to resident slab \a n, so that it is not discarded before less recently used ones
+        void          used (gsize n) { resident[slot[n]].last_used = ++access_count; }
+
+        friend std::ostream& operator<< (std::ostream& stream, const SlabStream& S);
+
+      protected:
+        class Entry {
+          public:
+            gsize    index, last_used;
+            guint8*  data;
+        };
+
+        std::vector<String>   files;
+        std::vector<gsize>    start;
+        gsize                 bytes, per_file;
+        guint                 max_slabs;
+
+        std::vector<Entry>    resident;
+        gsize                 access_count;
+
+        File::GZ              zf;
+        gsize                 next;
+
+        Glib::Thread*         prefetch;
+        guint8*               ahead;
+        gsize                 ahead_index;
+        String                ahead_error;
+        guint                 current;
+
+        // the index into resident of each slab, or G_MAXUINT if not resident:
+        std::vector<guint>    slot;
+
+        guint                 make_room (std::vector<gsize>& discarded, bool keep);
+        void                  seek (gsize n);
+        String                try_seek (gsize n);
+        void                  read_ahead ();
+        void                  finish_read_ahead ();
+    };
+
+  }
+}
+
+#endif
+
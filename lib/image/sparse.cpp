@@ -0,0 +1,315 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <zlib.h>
+#include <fstream>
+#include <glib/gstdio.h>
+#include <glibmm/stringutils.h>
+
+#include "image/sparse.h"
+#include "image/header.h"
+#include "get_set.h"
+#include "thread.h"
+
+#define SPARSE_INDEX_ENTRY_SIZE 16
+#define SPARSE_COMPRESSION_LEVEL 6
+
+namespace MR {
+  namespace Image {
+
+    namespace {
+
+      // checks the modified blocks for non-zero values, and compresses
+      // those that need to be stored if required, across multiple threads:
+      class BlockEncoder {
+        public:
+          BlockEncoder (const std::vector<guint8*>& blocks, const std::vector<guint8>& modified, gsize block_bytes, bool compress) :
+            buffer (blocks), is_modified (modified), bytes (block_bytes), compressed (compress),
+            empty (blocks.size(), 0), output (compress ? blocks.size() : 0), loop (blocks.size(), 16) { }
+
+          void execute ()
+          {
+            gsize first, last;
+            while (loop.next (first, last)) {
+              for (gsize n = first; n < last; n++) {
+                if (!is_modified[n]) continue;
+                if (is_zero (buffer[n])) { empty[n] = 1; continue; }
+                if (compressed) compress (n);
+              }
+            }
+          }
+
+          void check () const { if (error.size()) throw Exception (error); }
+
+          const std::vector<guint8*>& buffer;
+          const std::vector<guint8>& is_modified;
+          const gsize bytes;
+          const bool compressed;
+          std::vector<guint8> empty;
+          std::vector< std::vector<guint8> > output;
+
+        private:
+          Thread::Loop loop;
+          Glib::Mutex mutex;
+          String error;
+
+          bool is_zero (const guint8* data) const
+          {
+            for (gsize i = 0; i < bytes; i++)
+              if (data[i]) return (false);
+            return (true);
+          }
+
+          void compress (gsize n)
+          {
+            uLongf size = compressBound (bytes);
+            output[n].resize (size);
+            if (compress2 (&output[n][0], &size, buffer[n], bytes, SPARSE_COMPRESSION_LEVEL) != Z_OK) {
+              Glib::Mutex::Lock lock (mutex);
+              if (error.empty()) error = "error compressing sparse image data";
+              return;
+            }
+            output[n].resize (size);
+          }
+      };
+
+    }
+
+
+
+
+    Sparse::Sparse (const String& name, gsize index_offset_in_file, gsize block_size, bool compress) :
+      filename (name),
+      index_offset (index_offset_in_file),
+      block_elements (block_size),
+      block_bytes (0),
+      compressed (compress),
+      readonly (true),
+      is_new (false),
+      zero (NULL)
+    {
+    }
+
+
+
+    Sparse::Sparse (const String& name, const std::vector<guint8>& file_header, gsize block_size, bool compress) :
+      filename (name),
+      header (file_header),
+      index_offset (file_header.size()),
+      block_elements (block_size),
+      block_bytes (0),
+      compressed (compress),
+      readonly (false),
+      is_new (true),
+      zero (NULL)
+    {
+    }
+
+
+
+    Sparse::~Sparse ()
+    {
+      for (gsize n = 0; n < buffer.size(); n++) delete [] buffer[n];
+      delete [] zero;
+    }
+
+
+
+
+
+    void Sparse::map (const Header& H)
+    {
+      const guint bits = H.data_type.is_complex() ? H.data_type.bits()/2 : H.data_type.bits();
+      const gsize nelements = ( H.data_type.is_complex() ? 2 : 1 ) * H.voxel_count();
+      const gsize nblocks = ( nelements + block_elements - 1 ) / block_elements;
+
+      block_bytes = ( block_elements*bits + 7 ) / 8;
+      zero = new guint8 [block_bytes];
+      memset (zero, 0, block_bytes);
+
+      buffer.assign (nblocks, NULL);
+      modified.assign (nblocks, 0);
+      offsets.assign (nblocks, 0);
+      sizes.assign (nblocks, 0);
+
+      if (is_new) return;
+
+      fmap.init (filename);
+      fmap.map();
+      if (index_offset + nblocks*SPARSE_INDEX_ENTRY_SIZE > fmap.size())
+        throw Exception ("sparse image file \"" + filename + "\" is truncated");
+
+      const guint8* index = (const guint8*) fmap.address() + index_offset;
+      gsize count = 0;
+      for (gsize n = 0; n < nblocks; n++) {
+        offsets[n] = getLE<guint64> (index + n*SPARSE_INDEX_ENTRY_SIZE);
+        sizes[n] = getLE<guint64> (index + n*SPARSE_INDEX_ENTRY_SIZE + 8);
+        if (!offsets[n]) continue;
+        if (offsets[n] + sizes[n] > fmap.size() || ( !compressed && sizes[n] != block_bytes ))
+          throw Exception ("invalid block index in sparse image file \"" + filename + "\"");
+        count++;
+      }
+
+      debug ("sparse image \"" + filename + "\" holds " + str (count) + " non-empty blocks out of " + str (nblocks));
+    }
+
+
+
+
+
+    void Sparse::unmap (const Header& H)
+    {
+      // a new image must be written out even if it was never accessed:
+      if (!zero) {
+        if (!is_new) return;
+        map (H);
+      }
+
+      bool changed = is_new;
+      for (gsize n = 0; n < modified.size() && !changed; n++)
+        if (modified[n]) changed = true;
+
+      if (changed && !readonly) write();
+
+      for (gsize n = 0; n < buffer.size(); n++) delete [] buffer[n];
+      buffer.clear();
+      modified.clear();
+      offsets.clear();
+      sizes.clear();
+      delete [] zero;
+      zero = NULL;
+      if (fmap.is_mapped()) fmap.unmap();
+    }
+
+
+
+
+
+    guint8* Sparse::block (gsize n)
+    {
+      if (buffer[n]) return (buffer[n]);
+      if (!offsets[n]) return (zero);
+
+      guint8* data = (guint8*) fmap.address() + offsets[n];
+      if (!compressed) return (data);
+
+      buffer[n] = new guint8 [block_bytes];
+      uLongf size = block_bytes;
+      if (uncompress (buffer[n], &size, data, sizes[n]) != Z_OK || size != block_bytes)
+        throw Exception ("error uncompressing block " + str (n) + " of sparse image \"" + filename + "\"");
+      return (buffer[n]);
+    }
+
+
+
+
+    guint8* Sparse::modify (gsize n)
+    {
+      if (!buffer[n]) {
+        guint8* data = block (n);
+        if (!buffer[n]) {
+          buffer[n] = new guint8 [block_bytes];
+          memcpy (buffer[n], data, block_bytes);
+        }
+      }
+      return (buffer[n]);
+    }
+
+
+
+
+
+    void Sparse::write ()
+    {
+      info ("writing sparse image \"" + filename + "\"...");
+
+      BlockEncoder encoder (buffer, modified, block_bytes, compressed);
+      Thread::run (encoder);
+      encoder.check();
+
+      const gsize nblocks = modified.size();
+      std::vector<const guint8*> data (nblocks, NULL);
+      std::vector<guint64> new_sizes (nblocks, 0);
+      for (gsize n = 0; n < nblocks; n++) {
+        if (modified[n]) {
+          if (encoder.empty[n]) continue;
+          if (compressed) { data[n] = &encoder.output[n][0]; new_sizes[n] = encoder.output[n].size(); }
+          else { data[n] = buffer[n]; new_sizes[n] = block_bytes; }
+        }
+        else if (offsets[n]) {
+          data[n] = (const guint8*) fmap.address() + offsets[n];
+          new_sizes[n] = sizes[n];
+        }
+      }
+
+      std::vector<guint8> index (nblocks*SPARSE_INDEX_ENTRY_SIZE, 0);
+      guint64 pos = index_offset + index.size();
+      gsize count = 0;
+      for (gsize n = 0; n < nblocks; n++) {
+        if (!data[n]) continue;
+        putLE<guint64> (pos, &index[n*SPARSE_INDEX_ENTRY_SIZE]);
+        putLE<guint64> (new_sizes[n], &index[n*SPARSE_INDEX_ENTRY_SIZE+8]);
+        pos += new_sizes[n];
+        count++;
+      }
+
+      // an existing file is still needed for its unmodified blocks, so the
+      // new version is written alongside it and then moved into place:
+      String target (is_new ? filename : filename + ".tmp");
+      std::ofstream out (target.c_str(), std::ios::out | std::ios::binary);
+      if (!out) throw Exception ("error creating file \"" + target + "\": " + Glib::strerror(errno));
+
+      if (is_new) out.write ((const char*) &header[0], header.size());
+      else out.write ((const char*) fmap.address(), index_offset);
+      out.write ((const char*) &index[0], index.size());
+      for (gsize n = 0; n < nblocks; n++)
+        if (data[n]) out.write ((const char*) data[n], new_sizes[n]);
+
+      out.close();
+      if (!out) throw Exception ("error writing file \"" + target + "\": " + Glib::strerror(errno));
+
+      if (!is_new && g_rename (target.c_str(), filename.c_str()))
+        throw Exception ("error replacing file \"" + filename + "\": " + Glib::strerror(errno));
+
+      debug ("sparse image \"" + filename + "\" written with " + str (count) + " non-empty blocks out of " + str (nblocks));
+
+      is_new = false;
+      header.clear();
+    }
+
+
+
+
+
+    std::ostream& operator<< (std::ostream& stream, const Sparse& S)
+    {
+      gsize count = 0;
+      for (gsize n = 0; n < S.buffer.size(); n++)
+        if (S.buffer[n]) count++;
+      stream << S.filename << ", " << S.num_blocks() << " blocks of " << S.block_elements << " elements"
+        << ( S.compressed ? " (compressed)" : "" ) << ", " << count << " held in memory";
+      return (stream);
+    }
+
+  }
+}
+
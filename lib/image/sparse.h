@@ -0,0 +1,94 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef __image_sparse_h__
+#define __image_sparse_h__
+
+#include "file/mmap.h"
+
+namespace MR {
+  namespace Image {
+
+    class Header;
+
+    //! block-sparse storage of image data, as used by the MRtrix sparse format
+    /*! The data are split into blocks of a fixed number of consecutive
+     * elements, in the order in which they are stored. The file holds an
+     * index giving the location and size of each block, followed by the
+     * non-empty blocks only, each optionally compressed.
+     *
+     * Blocks are only read from the file the first time they are accessed,
+     * and all empty blocks refer to the same zero-filled buffer, so that
+     * reading from empty regions of the image never touches the disk. A
+     * block is copied into memory the first time it is modified, and all
+     * non-empty blocks are written back along with the index when the image
+     * is closed. This class is used by the Mapper, which is responsible for
+     * serialising calls to block() and modify(). */
+    class Sparse {
+      public:
+        //! access the existing file \a filename, with the index starting \a index_offset bytes into the file
+        Sparse (const String& filename, gsize index_offset, gsize block_size, bool compressed);
+        //! create the new file \a filename, starting with \a header (which includes any padding up to the index)
+        Sparse (const String& filename, const std::vector<guint8>& header, gsize block_size, bool compressed);
+        ~Sparse ();
+
+        void          map (const Header& H);
+        void          unmap (const Header& H);
+        void          set_read_only (bool read_only) { readonly = read_only; }
+
+        const String& name () const           { return (filename); }
+        gsize         block_size () const     { return (block_elements); }
+        gsize         num_blocks () const     { return (modified.size()); }
+        bool          is_compressed () const  { return (compressed); }
+        bool          is_modified (gsize n) const { return (modified[n]); }
+
+        //! the data for block \a n, for read access only
+        guint8*       block (gsize n);
+        //! the data for block \a n, copied into memory if necessary so that it can be modified
+        /*! The block is only flagged as modified once mark_modified() is
+         * called, which should be done after the caller has stopped using
+         * any pointer previously returned by block(). */
+        guint8*       modify (gsize n);
+        void          mark_modified (gsize n) { modified[n] = 1; }
+
+        friend std::ostream& operator<< (std::ostream& stream, const Sparse& S);
+
+      protected:
+        String                filename;
+        std::vector<guint8>   header;
+        gsize                 index_offset, block_elements, block_bytes;
+        bool                  compressed, readonly, is_new;
+
+        File::MMap            fmap;
+        std::vector<guint64>  offsets, sizes;
+        std::vector<guint8*>  buffer;
+        std::vector<guint8>   modified;
+        guint8*               zero;
+
+        void                  write ();
+    };
+
+  }
+}
+
+#endif
+
@@ -0,0 +1,211 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef __math_eig3_h__
+#define __math_eig3_h__
+
+#include <cmath>
+#include "mrtrix.h"
+
+namespace MR {
+  namespace Math {
+
+    /** \defgroup eig3 3x3 symmetric eigen-decomposition
+     * \brief closed-form eigenvalues & eigenvectors of symmetric 3x3 matrices
+     *
+     * These functions operate directly on the 6 unique elements of the
+     * matrix, in the same order as used for diffusion tensors:
+     * [ xx yy zz xy xz yz ]. The eigenvalues are computed analytically using
+     * the trigonometric solution of the characteristic cubic, and the
+     * eigenvectors from cross-products of the rows of (A - lambda I), taking
+     * care to remain accurate when two or all three eigenvalues coincide.
+     * Everything is held on the stack, so that these functions can be used
+     * concurrently from multiple threads.
+     *
+     * Eigenvalues are sorted in ascending order, and the corresponding
+     * eigenvectors are stored as the columns of \a evec (i.e. evec[i][j] is
+     * component i of eigenvector j), as done by Math::eig(). */
+    // @{
+
+    // helpers for eig3(), not intended for use elsewhere:
+    namespace detail {
+
+      inline double eig3_dot (const double* a, const double* b) { return (a[0]*b[0] + a[1]*b[1] + a[2]*b[2]); }
+
+      inline void eig3_cross (double* c, const double* a, const double* b)
+      {
+        c[0] = a[1]*b[2] - a[2]*b[1];
+        c[1] = a[2]*b[0] - a[0]*b[2];
+        c[2] = a[0]*b[1] - a[1]*b[0];
+      }
+
+      inline void eig3_normalise (double* v)
+      {
+        double norm = sqrt (eig3_dot (v, v));
+        v[0] /= norm; v[1] /= norm; v[2] /= norm;
+      }
+
+      // the eigenvalues of the scaled matrix a, in ascending order. This is
+      // branch-free, so that loops over many tensors can be vectorised by the
+      // compiler where vectorised maths routines are available:
+      inline void eig3_values (const double* a, double* evals)
+      {
+        const double q = ( a[0] + a[1] + a[2] ) / 3.0;
+        const double b0 = a[0] - q, b1 = a[1] - q, b2 = a[2] - q;
+        const double p1 = a[3]*a[3] + a[4]*a[4] + a[5]*a[5];
+        const double p = sqrt (( b0*b0 + b1*b1 + b2*b2 + 2.0*p1 ) / 6.0);
+        const double pd = p > 0.0 ? p : 1.0;
+
+        // half the determinant of (A - qI)/p, i.e. cos (3 phi):
+        double r = ( b0*(b1*b2 - a[5]*a[5]) - a[3]*(a[3]*b2 - a[5]*a[4]) + a[4]*(a[3]*a[5] - b1*a[4]) ) / ( 2.0*pd*pd*pd );
+        r = r < -1.0 ? -1.0 : ( r > 1.0 ? 1.0 : r );
+        const double phi = acos (r) / 3.0;
+
+        evals[2] = q + 2.0*p*cos (phi);
+        evals[0] = q + 2.0*p*cos (phi + 2.0*M_PI/3.0);
+        const double mid = 3.0*q - evals[0] - evals[2];
+        evals[1] = mid < evals[0] ? evals[0] : ( mid > evals[2] ? evals[2] : mid );
+      }
+
+      // the eigenvector for the eigenvalue lambda, known to be distinct
+      // from the other two: the null space of (A - lambda I) is given by the
+      // cross-product of any two independent rows, the largest of which is
+      // the most accurate:
+      inline void eig3_distinct_vector (const double* a, double lambda, double* v)
+      {
+        const double r0[] = { a[0]-lambda, a[3], a[4] };
+        const double r1[] = { a[3], a[1]-lambda, a[5] };
+        const double r2[] = { a[4], a[5], a[2]-lambda };
+        double c[3][3];
+        eig3_cross (c[0], r0, r1);
+        eig3_cross (c[1], r0, r2);
+        eig3_cross (c[2], r1, r2);
+        const double n[] = { eig3_dot (c[0], c[0]), eig3_dot (c[1], c[1]), eig3_dot (c[2], c[2]) };
+        int i = n[0] > n[1] ? 0 : 1;
+        if (n[2] > n[i]) i = 2;
+        if (n[i] > 0.0) {
+          v[0] = c[i][0] / sqrt (n[i]); v[1] = c[i][1] / sqrt (n[i]); v[2] = c[i][2] / sqrt (n[i]);
+        }
+        else { v[0] = 1.0; v[1] = v[2] = 0.0; }
+      }
+
+      // given the unit eigenvector v0, the eigenvector for lambda among the
+      // vectors orthogonal to v0 is found by solving the 2x2 problem in that
+      // plane. If lambda is a double eigenvalue, any vector in the plane will do:
+      inline void eig3_orthogonal_vector (const double* a, double lambda, const double* v0, double* v)
+      {
+        double u[3], w[3];
+        if (fabs (v0[0]) > fabs (v0[1])) { double s = 1.0/sqrt (v0[0]*v0[0] + v0[2]*v0[2]); u[0] = -v0[2]*s; u[1] = 0.0; u[2] = v0[0]*s; }
+        else { double s = 1.0/sqrt (v0[1]*v0[1] + v0[2]*v0[2]); u[0] = 0.0; u[1] = v0[2]*s; u[2] = -v0[1]*s; }
+        eig3_cross (w, v0, u);
+
+        const double Au[] = { a[0]*u[0] + a[3]*u[1] + a[4]*u[2], a[3]*u[0] + a[1]*u[1] + a[5]*u[2], a[4]*u[0] + a[5]*u[1] + a[2]*u[2] };
+        const double Aw[] = { a[0]*w[0] + a[3]*w[1] + a[4]*w[2], a[3]*w[0] + a[1]*w[1] + a[5]*w[2], a[4]*w[0] + a[5]*w[1] + a[2]*w[2] };
+        double m00 = eig3_dot (u, Au) - lambda, m01 = eig3_dot (u, Aw), m11 = eig3_dot (w, Aw) - lambda;
+
+        double x, y;
+        if (fabs (m00) >= fabs (m11)) {
+          if (fabs (m00) + fabs (m01) == 0.0) { x = 1.0; y = 0.0; }
+          else if (fabs (m00) >= fabs (m01)) { y = 1.0; x = -m01/m00; }
+          else { x = 1.0; y = -m00/m01; }
+        }
+        else {
+          if (fabs (m11) >= fabs (m01)) { x = 1.0; y = -m01/m11; }
+          else { y = 1.0; x = -m11/m01; }
+        }
+
+        for (int i = 0; i < 3; i++) v[i] = x*u[i] + y*w[i];
+        eig3_normalise (v);
+      }
+
+      // scale to avoid overflow or underflow in the cubic:
+      inline double eig3_scale (const float* t, double* a)
+      {
+        double scale = 0.0;
+        for (int i = 0; i < 6; i++) if (fabs (t[i]) > scale) scale = fabs (t[i]);
+        const double s = scale > 0.0 ? 1.0/scale : 1.0;
+        for (int i = 0; i < 6; i++) a[i] = s*t[i];
+        return (scale > 0.0 ? scale : 1.0);
+      }
+
+    }
+
+
+
+    //! compute the eigenvalues of the symmetric 3x3 matrix \a t, in ascending order
+    inline void eig3 (const float* t, double* evals)
+    {
+      double a[6];
+      const double scale = detail::eig3_scale (t, a);
+      detail::eig3_values (a, evals);
+      for (int i = 0; i < 3; i++) evals[i] *= scale;
+    }
+
+
+
+    //! compute the eigenvalues & eigenvectors of the symmetric 3x3 matrix \a t
+    inline void eig3 (const float* t, double* evals, double evec[3][3])
+    {
+      double a[6];
+      const double scale = detail::eig3_scale (t, a);
+      detail::eig3_values (a, evals);
+
+      // start with whichever of the major or minor eigenvalue is furthest
+      // from the middle one, since it must then be distinct:
+      double v[3][3];
+      if (evals[2] - evals[1] >= evals[1] - evals[0]) {
+        detail::eig3_distinct_vector (a, evals[2], v[2]);
+        detail::eig3_orthogonal_vector (a, evals[1], v[2], v[1]);
+        detail::eig3_cross (v[0], v[1], v[2]);
+      }
+      else {
+        detail::eig3_distinct_vector (a, evals[0], v[0]);
+        detail::eig3_orthogonal_vector (a, evals[1], v[0], v[1]);
+        detail::eig3_cross (v[2], v[0], v[1]);
+      }
+
+      for (int i = 0; i < 3; i++) {
+        evals[i] *= scale;
+        for (int j = 0; j < 3; j++)
+          evec[i][j] = v[j][i];
+      }
+    }
+
+
+
+    //! compute the eigenvalues of \a count symmetric 3x3 matrices
+    /*! The 6 unique elements of each matrix are stored consecutively in \a
+     * t, and the 3 eigenvalues of each are stored in ascending order in \a
+     * evals. */
+    inline void eig3 (const float* t, double* evals, gsize count)
+    {
+      for (gsize n = 0; n < count; n++)
+        eig3 (t + 6*n, evals + 3*n);
+    }
+
+    // @}
+
+  }
+}
+
+#endif
+
@@ -0,0 +1,187 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <gsl/gsl_fft_complex.h>
+#include <gsl/gsl_fft_complex_float.h>
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_real_float.h>
+#include <gsl/gsl_fft_halfcomplex.h>
+#include <gsl/gsl_fft_halfcomplex_float.h>
+
+#include "math/fft.h"
+
+namespace MR {
+  namespace Math {
+
+    // the wavetables & workspaces for a given length, allocated as needed:
+    class FFT::Plan {
+      public:
+        Plan () :
+          complex_wavetable (NULL), complex_workspace (NULL),
+          complex_wavetable_float (NULL), complex_workspace_float (NULL),
+          real_wavetable (NULL), real_workspace (NULL),
+          real_wavetable_float (NULL), real_workspace_float (NULL) { }
+
+        ~Plan ()
+        {
+          if (complex_wavetable) gsl_fft_complex_wavetable_free (complex_wavetable);
+          if (complex_workspace) gsl_fft_complex_workspace_free (complex_workspace);
+          if (complex_wavetable_float) gsl_fft_complex_wavetable_float_free (complex_wavetable_float);
+          if (complex_workspace_float) gsl_fft_complex_workspace_float_free (complex_workspace_float);
+          if (real_wavetable) gsl_fft_real_wavetable_free (real_wavetable);
+          if (real_workspace) gsl_fft_real_workspace_free (real_workspace);
+          if (real_wavetable_float) gsl_fft_real_wavetable_float_free (real_wavetable_float);
+          if (real_workspace_float) gsl_fft_real_workspace_float_free (real_workspace_float);
+        }
+
+        gsl_fft_complex_wavetable*        complex_wavetable;
+        gsl_fft_complex_workspace*        complex_workspace;
+        gsl_fft_complex_wavetable_float*  complex_wavetable_float;
+        gsl_fft_complex_workspace_float*  complex_workspace_float;
+        gsl_fft_real_wavetable*           real_wavetable;
+        gsl_fft_real_workspace*           real_workspace;
+        gsl_fft_real_wavetable_float*     real_wavetable_float;
+        gsl_fft_real_workspace_float*     real_workspace_float;
+        std::vector<double>               real;
+        std::vector<float>                real_float;
+    };
+
+
+
+    namespace {
+
+      // the output of gsl_fft_real_transform() follows the opposite sign
+      // convention to that used by fft() (i.e. gsl_fft_complex_inverse()),
+      // and is not normalised:
+      template <typename T> inline void to_forward_convention (ComplexNumber<T>* data, guint length)
+      {
+        const T norm = T(1.0) / length;
+        for (guint n = 0; n < length; n++) {
+          data[n].re() *= norm;
+          data[n].im() *= -norm;
+        }
+      }
+
+    }
+
+
+
+
+    FFT::~FFT ()
+    {
+      for (std::map<guint,Plan*>::iterator i = plans.begin(); i != plans.end(); ++i) 
+        delete i->second;
+    }
+
+
+
+    FFT::Plan& FFT::plan (guint length)
+    {
+      Plan*& P (plans[length]);
+      if (!P) P = new Plan;
+      return (*P);
+    }
+
+
+
+
+    void FFT::fft (ComplexNumber<double>* data, guint length, guint count, bool inverse)
+    {
+      if (!length) return;
+      Plan& P (plan (length));
+      if (!P.complex_wavetable) {
+        P.complex_wavetable = gsl_fft_complex_wavetable_alloc (length);
+        P.complex_workspace = gsl_fft_complex_workspace_alloc (length);
+      }
+
+      for (guint n = 0; n < count; n++, data += length) {
+        if ( inverse ? 
+            gsl_fft_complex_forward (data->pointer(), 1, length, P.complex_wavetable, P.complex_workspace) :
+            gsl_fft_complex_inverse (data->pointer(), 1, length, P.complex_wavetable, P.complex_workspace)
+           ) throw Exception ("error computing FFT");
+      }
+    }
+
+
+
+    void FFT::fft (ComplexNumber<float>* data, guint length, guint count, bool inverse)
+    {
+      if (!length) return;
+      Plan& P (plan (length));
+      if (!P.complex_wavetable_float) {
+        P.complex_wavetable_float = gsl_fft_complex_wavetable_float_alloc (length);
+        P.complex_workspace_float = gsl_fft_complex_workspace_float_alloc (length);
+      }
+
+      for (guint n = 0; n < count; n++, data += length) {
+        if ( inverse ? 
+            gsl_fft_complex_float_forward (data->pointer(), 1, length, P.complex_wavetable_float, P.complex_workspace_float) :
+            gsl_fft_complex_float_inverse (data->pointer(), 1, length, P.complex_wavetable_float, P.complex_workspace_float)
+           ) throw Exception ("error computing FFT");
+      }
+    }
+
+
+
+    void FFT::real_fft (ComplexNumber<double>* data, guint length, guint count)
+    {
+      if (!length) return;
+      Plan& P (plan (length));
+      if (!P.real_wavetable) {
+        P.real_wavetable = gsl_fft_real_wavetable_alloc (length);
+        P.real_workspace = gsl_fft_real_workspace_alloc (length);
+        P.real.resize (length);
+      }
+
+      for (guint n = 0; n < count; n++, data += length) {
+        for (guint i = 0; i < length; i++) P.real[i] = data[i].re();
+        if (gsl_fft_real_transform (&P.real[0], 1, length, P.real_wavetable, P.real_workspace) ||
+            gsl_fft_halfcomplex_unpack (&P.real[0], data->pointer(), 1, length))
+          throw Exception ("error computing FFT");
+        to_forward_convention (data, length);
+      }
+    }
+
+
+
+    void FFT::real_fft (ComplexNumber<float>* data, guint length, guint count)
+    {
+      if (!length) return;
+      Plan& P (plan (length));
+      if (!P.real_wavetable_float) {
+        P.real_wavetable_float = gsl_fft_real_wavetable_float_alloc (length);
+        P.real_workspace_float = gsl_fft_real_workspace_float_alloc (length);
+        P.real_float.resize (length);
+      }
+
+      for (guint n = 0; n < count; n++, data += length) {
+        for (guint i = 0; i < length; i++) P.real_float[i] = data[i].re();
+        if (gsl_fft_real_float_transform (&P.real_float[0], 1, length, P.real_wavetable_float, P.real_workspace_float) ||
+            gsl_fft_halfcomplex_float_unpack (&P.real_float[0], data->pointer(), 1, length))
+          throw Exception ("error computing FFT");
+        to_forward_convention (data, length);
+      }
+    }
+
+  }
+}
+
@@ -23,61 +23,50 @@
 #ifndef __math_fft_h__
 #define __math_fft_h__
 
-#include <gsl/gsl_fft_complex.h>
+#include <map>
 #include "math/complex_number.h"
 
 namespace MR {
   namespace Math {
 
+    //! compute the discrete Fourier transform of complex or real data
+    /*! The wavetables and workspace needed for each length of data are
+     * allocated on first use, and kept for subsequent calls with the same
+     * length. A single FFT object should therefore be reused for all the
+     * transforms performed by a given thread, but must not be shared
+     * between threads.
+     *
+     * Lines of data are transformed in batches: the \a count lines of \a
+     * length values each are expected to be stored consecutively in memory.
+     * Both single and double precision are supported. */
     class FFT {
-      protected:
-        gsl_fft_complex_wavetable*  wavetable;
-        gsl_fft_complex_workspace*  workspace;
-
-        guint length;
-
       public:
-        FFT ();
+        FFT () { }
         ~FFT ();
 
-        void fft (std::vector<ComplexNumber<double> >& array, bool inverse = false);
-    };
-
-
-
-
-
+        //! transform \a array in place
+        void fft (std::vector<ComplexNumber<double> >& array, bool inverse = false) { if (array.size()) fft (&array[0], array.size(), 1, inverse); }
 
+        //! transform \a count consecutive lines of \a length values, in place
+        void fft (ComplexNumber<double>* data, guint length, guint count = 1, bool inverse = false);
+        //! transform \a count consecutive lines of \a length values, in place
+        void fft (ComplexNumber<float>* data, guint length, guint count = 1, bool inverse = false);
 
+        //! forward transform of real data
+        /*! Only the real part of the \a count lines of \a data is used. On
+         * output, \a data holds the full complex transform, identical to
+         * that returned by fft(). Since the transform of real data is
+         * conjugate-symmetric, this takes about half the time. */
+        void real_fft (ComplexNumber<double>* data, guint length, guint count = 1);
+        //! forward transform of real data
+        void real_fft (ComplexNumber<float>* data, guint length, guint count = 1);
 
+      protected:
+        class Plan;
+        std::map<guint,Plan*> plans;
 
-    inline FFT::FFT() { wavetable = NULL; workspace = NULL; length = 0; }
-    inline FFT::~FFT() 
-    { 
-      if (wavetable) gsl_fft_complex_wavetable_free (wavetable); 
-      if (workspace) gsl_fft_complex_workspace_free (workspace);
-    }
-
-    inline void FFT::fft (std::vector<ComplexNumber<double> >& array, bool inverse)
-    {
-      if (length != array.size()) {
-        if (wavetable) { gsl_fft_complex_wavetable_free (wavetable); wavetable = NULL; }
-        if (workspace) { gsl_fft_complex_workspace_free (workspace); workspace = NULL; }
-
-        length = array.size();
-
-        if (length) {
-          wavetable = gsl_fft_complex_wavetable_alloc (length);
-          workspace = gsl_fft_complex_workspace_alloc (length);
-        }
-        else return;
-      }
-
-      if ( inverse ? 
-          gsl_fft_complex_forward (array.front().pointer(), 1, array.size(), wavetable, workspace) :
-          gsl_fft_complex_inverse (array.front().pointer(), 1, array.size(), wavetable, workspace)
-          ) throw Exception ("error computing FFT");
-    }
+        Plan& plan (guint length);
+    };
 
   }
 }
@@ -86,5 +75,3 @@ namespace MR {
 
 #endif
 
-
-
@@ -0,0 +1,115 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "math/simulation.h"
+
+namespace MR {
+  namespace Math {
+
+    void RNG::set_seed (guint seed)
+    {
+      current_seed = seed;
+      has_spare = false;
+      gsl_rng_set (generator, seed);
+
+      // expand the seed into the 256-bit xoshiro state using splitmix64, as
+      // recommended by the authors of xoshiro. This never produces the
+      // all-zero state:
+      guint64 x = seed;
+      for (int n = 0; n < 4; n++) {
+        x += G_GUINT64_CONSTANT (0x9E3779B97F4A7C15);
+        guint64 z = x;
+        z = ( z ^ ( z >> 30 ) ) * G_GUINT64_CONSTANT (0xBF58476D1CE4E5B9);
+        z = ( z ^ ( z >> 27 ) ) * G_GUINT64_CONSTANT (0x94D049BB133111EB);
+        state[n] = z ^ ( z >> 31 );
+      }
+    }
+
+
+
+    RNG::Type RNG::type_from_name (const String& name)
+    {
+      String type (lowercase (name));
+      if (type == "mt19937") return (MT19937);
+      if (type == "xoshiro") return (Xoshiro);
+      throw Exception ("unknown random number generator \"" + name + "\"");
+    }
+
+
+
+    void RNG::fill_uniform (float* data, gsize count)
+    {
+      if (rng_type != Xoshiro) {
+        for (gsize n = 0; n < count; n++) 
+          data[n] = gsl_rng_uniform (generator);
+        return;
+      }
+
+      // the lowest bits of xoshiro256+ are of lower quality, but the upper 48
+      // bits are fine to use as two 24-bit deviates:
+      gsize n = 0;
+      for (; n+1 < count; n += 2) {
+        const guint64 x = next();
+        data[n] = to_float (x >> 40);
+        data[n+1] = to_float (( x >> 16 ) & 0xFFFFFF);
+      }
+      if (n < count) data[n] = uniform();
+    }
+
+
+
+    void RNG::fill_normal (float* data, gsize count, float SD)
+    {
+      fill_uniform (data, count);
+
+      gsize n = 0;
+      for (; n+1 < count; n += 2) {
+        box_muller (data+n);
+        data[n] *= SD;
+        data[n+1] *= SD;
+      }
+      if (n < count) data[n] = normal (SD);
+    }
+
+
+
+    void RNG::random_unit_vectors (float* data, gsize count)
+    {
+      // generate the 2 uniform deviates needed for each vector at the start
+      // of the buffer, and expand them in place from the end:
+      fill_uniform (data, 2*count);
+
+      for (gsize n = count; n > 0; n--) {
+        const float z = 2.0f * data[2*n-2] - 1.0f;
+        const float phi = 2.0 * M_PI * data[2*n-1];
+        float r = 1.0f - z*z;
+        r = r > 0.0f ? sqrt (r) : 0.0f;
+        float* v = data + 3*(n-1);
+        v[0] = r * cos (phi);
+        v[1] = r * sin (phi);
+        v[2] = z;
+      }
+    }
+
+  }
+}
+
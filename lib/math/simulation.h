@@ -31,33 +31,111 @@
 namespace MR {
   namespace Math {
 
+    //! a pseudo-random number generator
+    /*! Two generators are available: the GSL Mersenne Twister (MT19937, the
+     * default), and xoshiro256+ (Xoshiro), which is several times faster and
+     * passes the same statistical test suites for floating-point use. Each
+     * RNG object holds its own state, so that separate threads should use
+     * separate RNG objects.
+     *
+     * For code that consumes many random numbers at once, the fill_uniform(),
+     * fill_normal() and random_unit_vectors() functions generate them in
+     * bulk, in tight loops that the compiler can vectorise. With the Xoshiro
+     * generator, each 64-bit draw then provides two uniform deviates, and
+     * normal deviates are generated in pairs using the Box-Muller transform.
+     *
+     * \note the gsl_rng returned by operator() always uses the MT19937
+     * generator, whichever type is selected. */
     class RNG {
-      protected:
-        gsl_rng* generator;
-
       public:
-        RNG ()                { generator = gsl_rng_alloc (gsl_rng_mt19937); gsl_rng_set (generator, time (NULL)); }
-        RNG (guint seed)      { generator = gsl_rng_alloc (gsl_rng_mt19937); gsl_rng_set (generator, seed); }
+        enum Type { MT19937, Xoshiro };
+
+        RNG (Type type = MT19937)               : generator (gsl_rng_alloc (gsl_rng_mt19937)) { set_type (type, time (NULL)); }
+        RNG (guint seed, Type type = MT19937)   : generator (gsl_rng_alloc (gsl_rng_mt19937)) { set_type (type, seed); }
         ~RNG ()               { gsl_rng_free (generator); }
 
 
 
-        void      set_seed (guint seed)            { gsl_rng_set (generator, seed); }
+        void      set_seed (guint seed);
+        void      set_type (Type type)             { set_type (type, current_seed); }
+        void      set_type (Type type, guint seed) { rng_type = type; set_seed (seed); }
+        Type      type () const                    { return (rng_type); }
+
+        //! the generator type corresponding to \a name ("mt19937" or "xoshiro")
+        static Type type_from_name (const String& name);
 
 
         gsl_rng*  operator() ()                    { return (generator); }
 
-        float     uniform ()                       { return (gsl_rng_uniform (generator)); }
-        float     normal (float SD = 1.0)          { return (gsl_ran_gaussian (generator, SD)); }
+        float     uniform ()                       { return (rng_type == Xoshiro ? to_float (next() >> 40) : gsl_rng_uniform (generator)); }
+        float     normal (float SD = 1.0)
+        {
+          if (rng_type != Xoshiro) return (gsl_ran_gaussian (generator, SD));
+          if (has_spare) { has_spare = false; return (SD*spare); }
+          float u[] = { uniform(), uniform() };
+          box_muller (u);
+          spare = u[1];
+          has_spare = true;
+          return (SD*u[0]);
+        }
         float     rician (float amplitude, float SD)
         {
-          amplitude += gsl_ran_gaussian_ratio_method (generator, SD);
-          float imag = gsl_ran_gaussian_ratio_method (generator, SD);
+          if (rng_type == Xoshiro) amplitude += normal (SD);
+          else amplitude += gsl_ran_gaussian_ratio_method (generator, SD);
+          float imag = rng_type == Xoshiro ? normal (SD) : gsl_ran_gaussian_ratio_method (generator, SD);
           return (sqrt (amplitude*amplitude + imag*imag));
         }
 
-        void      shuffle (Vector& V) { gsl_ran_shuffle (generator, V.get_gsl_vector()->data, V.size(), sizeof (double)); }
-        template <class T> void shuffle (std::vector<T>& V) { gsl_ran_shuffle (generator, &V[0], V.size(), sizeof (T)); }
+        //! fill \a data with \a count deviates uniformly distributed over [0, 1)
+        void      fill_uniform (float* data, gsize count);
+        //! fill \a data with \a count normally distributed deviates, of zero mean and standard deviation \a SD
+        void      fill_normal (float* data, gsize count, float SD = 1.0);
+        //! fill \a data with \a count unit vectors uniformly distributed over the sphere
+        /*! the x, y & z components of each vector are stored consecutively. */
+        void      random_unit_vectors (float* data, gsize count);
+
+        void      shuffle (Vector& V) { shuffle (V.get_gsl_vector()->data, V.size()); }
+        template <class T> void shuffle (std::vector<T>& V) { if (V.size()) shuffle (&V[0], V.size()); }
+
+      protected:
+        gsl_rng*  generator;
+        Type      rng_type;
+        guint     current_seed;
+        guint64   state[4];
+        float     spare;
+        bool      has_spare;
+
+        guint64   next ()
+        {
+          const guint64 result = state[0] + state[3];
+          const guint64 t = state[1] << 17;
+          state[2] ^= state[0];
+          state[3] ^= state[1];
+          state[1] ^= state[2];
+          state[0] ^= state[3];
+          state[2] ^= t;
+          state[3] = ( state[3] << 45 ) | ( state[3] >> 19 );
+          return (result);
+        }
+
+        // the 24 bits supplied form the mantissa of a float in [0, 1):
+        static float to_float (guint64 bits)        { return (float (bits) * (1.0f / 16777216.0f)); }
+
+        // transform 2 uniform deviates in [0, 1) into 2 independent unit normal deviates:
+        static void box_muller (float* u)
+        {
+          const float r = sqrt (-2.0f * log (1.0f - u[0]));
+          const float theta = 2.0 * M_PI * u[1];
+          u[0] = r * cos (theta);
+          u[1] = r * sin (theta);
+        }
+
+        template <class T> void shuffle (T* data, gsize size)
+        {
+          if (rng_type != Xoshiro) { gsl_ran_shuffle (generator, data, size, sizeof (T)); return; }
+          for (gsize i = size-1; i > 0 && i < size; i--) 
+            std::swap (data[i], data[gsize ((next() >> 32) * (i+1) >> 32)]);
+        }
     };
 
 
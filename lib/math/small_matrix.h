@@ -0,0 +1,183 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef __math_small_matrix_h__
+#define __math_small_matrix_h__
+
+#include "math/vector.h"
+
+#define MRTRIX_SMALL_MATRIX_ALIGNMENT 16
+
+namespace MR {
+  namespace Math {
+
+    /** \defgroup small_matrix Fixed-size matrices & vectors
+     * \brief small matrices & vectors whose size is known at compile time
+     *
+     * Unlike Math::Matrix and Math::Vector, these hold their data directly
+     * (i.e. on the stack for local variables), so that no memory needs to be
+     * allocated when they are created. They are intended for the small
+     * temporaries used in inner loops (3x3 rotations, 3x4 affine transforms,
+     * the 4x4 image transforms, or vectors of up to 45 SH coefficients),
+     * where the cost of allocating a gsl_matrix would otherwise dominate. The
+     * data are stored in row-major order, aligned to 16 bytes so that the
+     * compiler can vectorise the loops over them, and the sizes are
+     * compile-time constants so that these loops can be fully unrolled.
+     *
+     * Data can be exchanged with the GSL-based classes using copy() and
+     * copy_to(); the dimensions must then match exactly. */
+    // @{
+
+    template <typename T, int R, int C> class SmallMatrix;
+
+    //! a vector of \a N elements of type \a T
+    template <typename T, int N> class SmallVector {
+      public:
+        SmallVector () { }
+        explicit SmallVector (const Vector& V) { copy (V); }
+
+        int       size () const                 { return (N); }
+        T&        operator[] (int i)            { return (v[i]); }
+        const T&  operator[] (int i) const      { return (v[i]); }
+        T*        ptr ()                        { return (v); }
+        const T*  ptr () const                  { return (v); }
+
+        void      zero ()                       { set_all (T(0)); }
+        void      set_all (T value)             { for (int i = 0; i < N; i++) v[i] = value; }
+
+        void      copy (const Vector& V)
+        {
+          if (V.size() != (guint) N)
+            throw Exception ("vector dimensions do not match");
+          for (int i = 0; i < N; i++) v[i] = V[i];
+        }
+
+        void      copy_to (Vector& V) const
+        {
+          V.allocate (N);
+          for (int i = 0; i < N; i++) V[i] = v[i];
+        }
+
+        T         dot (const SmallVector& x) const { T val = T(0); for (int i = 0; i < N; i++) val += v[i]*x[i]; return (val); }
+        T         norm2 () const                { return (dot (*this)); }
+        void      multiply (T val)              { for (int i = 0; i < N; i++) v[i] *= val; }
+
+        //! set this vector to \a M times \a x
+        template <int C> void multiply (const SmallMatrix<T,N,C>& M, const SmallVector<T,C>& x)
+        {
+          for (int i = 0; i < N; i++) {
+            T val = T(0);
+            for (int j = 0; j < C; j++) val += M(i,j) * x[j];
+            v[i] = val;
+          }
+        }
+
+        //! set this vector to the transpose of \a M times \a x
+        template <int R> void multiply_trans (const SmallMatrix<T,R,N>& M, const SmallVector<T,R>& x)
+        {
+          for (int i = 0; i < N; i++) {
+            T val = T(0);
+            for (int j = 0; j < R; j++) val += M(j,i) * x[j];
+            v[i] = val;
+          }
+        }
+
+      protected:
+        T v[N] __attribute__ ((aligned (MRTRIX_SMALL_MATRIX_ALIGNMENT)));
+    };
+
+
+
+
+    //! an \a R x \a C matrix of elements of type \a T
+    template <typename T, int R, int C> class SmallMatrix {
+      public:
+        SmallMatrix () { }
+        explicit SmallMatrix (const Matrix& M) { copy (M); }
+
+        int       rows () const                 { return (R); }
+        int       columns () const              { return (C); }
+        T&        operator() (int i, int j)     { return (v[i*C+j]); }
+        const T&  operator() (int i, int j) const { return (v[i*C+j]); }
+        T*        ptr ()                        { return (v); }
+        const T*  ptr () const                  { return (v); }
+
+        void      zero ()                       { for (int i = 0; i < R*C; i++) v[i] = T(0); }
+        void      identity ()                   { zero(); for (int i = 0; i < MIN (R,C); i++) v[i*(C+1)] = T(1); }
+
+        void      copy (const Matrix& M)
+        {
+          if (M.rows() != (guint) R || M.columns() != (guint) C)
+            throw Exception ("matrix dimensions do not match");
+          for (int i = 0; i < R; i++)
+            for (int j = 0; j < C; j++)
+              v[i*C+j] = M(i,j);
+        }
+
+        //! copy the top-left corner of \a M, which must be at least as large
+        void      copy_block (const Matrix& M)
+        {
+          if (M.rows() < (guint) R || M.columns() < (guint) C)
+            throw Exception ("matrix dimensions do not match");
+          for (int i = 0; i < R; i++)
+            for (int j = 0; j < C; j++)
+              v[i*C+j] = M(i,j);
+        }
+
+        void      copy_to (Matrix& M) const
+        {
+          M.allocate (R, C);
+          for (int i = 0; i < R; i++)
+            for (int j = 0; j < C; j++)
+              M(i,j) = v[i*C+j];
+        }
+
+        //! set this matrix to \a A times \a B
+        template <int K> void multiply (const SmallMatrix<T,R,K>& A, const SmallMatrix<T,K,C>& B)
+        {
+          for (int i = 0; i < R; i++) {
+            for (int j = 0; j < C; j++) {
+              T val = T(0);
+              for (int k = 0; k < K; k++) val += A(i,k) * B(k,j);
+              v[i*C+j] = val;
+            }
+          }
+        }
+
+        void      transpose (const SmallMatrix<T,C,R>& A)
+        {
+          for (int i = 0; i < R; i++)
+            for (int j = 0; j < C; j++)
+              v[i*C+j] = A(j,i);
+        }
+
+      protected:
+        T v[R*C] __attribute__ ((aligned (MRTRIX_SMALL_MATRIX_ALIGNMENT)));
+    };
+
+    // @}
+
+  }
+}
+
+#endif
+
@@ -191,9 +191,11 @@ namespace MR {
 
       class Lower {
         public:
-          Lower (int amount = 1)  { level_offset = amount; }
-          ~Lower () { level_offset = 0; }
+          Lower (int amount = 1) : previous (level_offset) { level_offset = amount; }
+          ~Lower () { level_offset = previous; }
           friend class Exception;
+        private:
+          int previous;
       };
 
     private:
@@ -0,0 +1,98 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "thread.h"
+
+namespace MR {
+  namespace Thread {
+
+    Messages* Messages::active = NULL;
+
+
+
+    // the last item holds any messages issued before a thread's first call
+    // to item():
+    Messages::Messages (gsize num_items) : queue (num_items+1)
+    {
+      assert (!active);
+      active = this;
+      previous[0] = print;
+      previous[1] = error;
+      previous[2] = info;
+      previous[3] = debug;
+      print = queue_print;
+      error = queue_error;
+      info = queue_info;
+      debug = queue_debug;
+    }
+
+
+
+    Messages::~Messages ()
+    {
+      print = previous[0];
+      error = previous[1];
+      info = previous[2];
+      debug = previous[3];
+      active = NULL;
+      flush();
+    }
+
+
+
+    void Messages::item (gsize index)
+    {
+      assert (index < queue.size()-1);
+      Glib::Mutex::Lock lock (mutex);
+      current[Glib::Thread::self()] = index;
+    }
+
+
+
+    void Messages::flush ()
+    {
+      std::vector<std::vector<Entry> > pending (queue.size());
+      {
+        Glib::Mutex::Lock lock (mutex);
+        pending.swap (queue);
+      }
+
+      for (guint n = 0; n < pending.size(); n++) {
+        for (guint i = 0; i < pending[n].size(); i++) 
+          previous[pending[n][i].type] (pending[n][i].msg);
+      }
+    }
+
+
+
+    void Messages::add (guint type, const String& msg)
+    {
+      Glib::Mutex::Lock lock (mutex);
+      std::map<Glib::Thread*,gsize>::const_iterator i = current.find (Glib::Thread::self());
+      Entry entry;
+      entry.type = type;
+      entry.msg = msg;
+      queue[i == current.end() ? queue.size()-1 : i->second].push_back (entry);
+    }
+
+  }
+}
@@ -0,0 +1,223 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef __thread_h__
+#define __thread_h__
+
+#include <map>
+#include <exception>
+#include <glibmm/thread.h>
+#include "file/config.h"
+
+namespace MR {
+  namespace Thread {
+
+    //! the number of threads to use, as set by the NumberOfThreads config file entry
+    inline guint number ()
+    {
+      int num = File::Config::get_int ("NumberOfThreads", 1);
+      return (num < 1 ? 1 : num);
+    }
+
+
+
+    //! runs the execute() method of a functor, recording any exception thrown
+    /*! An exception escaping a thread would terminate the program, so it is
+     * held here instead, for run() to rethrow once all threads have
+     * completed. Only the first exception is kept. */
+    template <class Functor> class Launcher {
+      public:
+        Launcher (Functor& functor_to_run) : functor (functor_to_run), exception (NULL) { }
+        ~Launcher () { delete exception; }
+
+        void execute ()
+        {
+          try { functor.execute(); }
+          // copied rather than constructed, since it was displayed when thrown:
+          catch (Exception& E) { record (new Exception (E), ""); }
+          catch (std::exception& E) { record (NULL, E.what()); }
+          catch (...) { record (NULL, "unknown exception"); }
+        }
+
+        //! throw the exception recorded, if any
+        void rethrow () const
+        {
+          if (exception) throw *exception;
+          if (failure.size()) throw Exception ("error in worker thread: " + failure);
+        }
+
+      protected:
+        Functor& functor;
+        Glib::Mutex mutex;
+        Exception* exception;
+        String failure;
+
+        void record (Exception* E, const String& msg)
+        {
+          Glib::Mutex::Lock lock (mutex);
+          if (exception || failure.size()) { delete E; return; }
+          exception = E;
+          failure = msg;
+        }
+    };
+
+
+
+    //! run the execute() method of \a functor in \a num_threads threads
+    /*! One of the threads is the calling thread; the function returns once
+     * all threads have completed. The functor is shared between all threads,
+     * and is responsible for its own locking. If any of the threads throws
+     * an exception, it is rethrown here once all threads have completed.
+     * The thread system must have been initialised beforehand, as done by
+     * the App class. */
+    template <class Functor> inline void run (Functor& functor, guint num_threads = number())
+    {
+      if (num_threads < 2) { functor.execute(); return; }
+
+      Launcher<Functor> launcher (functor);
+      std::vector<Glib::Thread*> threads (num_threads-1);
+      for (guint n = 0; n < num_threads-1; n++)
+        threads[n] = Glib::Thread::create (sigc::mem_fun (launcher, &Launcher<Functor>::execute), true);
+
+      launcher.execute();
+
+      for (guint n = 0; n < num_threads-1; n++)
+        threads[n]->join();
+
+      launcher.rethrow();
+    }
+
+
+
+    //! hands out consecutive ranges of [0, total) to multiple threads
+    class Loop {
+      public:
+        Loop (gsize total, gsize chunk_size = 1) : current (0), end (total), chunk (chunk_size ? chunk_size : 1) { }
+
+        //! get the next range to process
+        /*! \return false once all items have been handed out */
+        bool next (gsize& first, gsize& last)
+        {
+          Glib::Mutex::Lock lock (mutex);
+          if (current >= end) return (false);
+          first = current;
+          current += chunk;
+          if (current > end) current = end;
+          last = current;
+          return (true);
+        }
+
+        gsize size () const { return (end); }
+
+      protected:
+        Glib::Mutex mutex;
+        gsize current, end, chunk;
+    };
+
+
+
+    //! keeps track of the progress made by multiple threads
+    /*! The ProgressBar can only be updated from the thread that created this
+     * object, so the other threads simply record their progress, and the
+     * ProgressBar catches up the next time the main thread calls inc() or
+     * update(). */
+    class Progress {
+      public:
+        Progress () : main (Glib::Thread::self()), done (0), shown (0) { }
+
+        void inc (gsize count = 1)
+        {
+          {
+            Glib::Mutex::Lock lock (mutex);
+            done += count;
+          }
+          if (Glib::Thread::self() == main) update();
+        }
+
+        //! bring the ProgressBar up to date - only call from the main thread
+        void update ()
+        {
+          gsize target;
+          {
+            Glib::Mutex::Lock lock (mutex);
+            target = done;
+          }
+          for (; shown < target; shown++) ProgressBar::inc();
+        }
+
+      protected:
+        Glib::Thread* main;
+        Glib::Mutex mutex;
+        gsize done, shown;
+    };
+
+
+
+    //! holds back the messages issued by multiple threads, to display them from the main thread
+    /*! The print(), error(), info() and debug() functions (also invoked
+     * whenever an Exception is constructed) are not thread-safe: in
+     * graphical applications for instance, they update the GUI. While an
+     * object of this class exists, their messages are queued instead, each
+     * under the item that the issuing thread last passed to item(). They are
+     * displayed from the thread that created the object when flush() is
+     * called or the object goes out of scope, in order of the items, so that
+     * the output does not depend on how the work was split between threads.
+     * Only one such object may exist at any one time. */
+    class Messages {
+      public:
+        Messages (gsize num_items);
+        ~Messages ();
+
+        //! file the messages subsequently issued by the calling thread under item \a index
+        void item (gsize index);
+
+        //! display the messages queued so far - only call from the main thread
+        void flush ();
+
+      protected:
+        class Entry {
+          public:
+            guint type;
+            String msg;
+        };
+
+        Glib::Mutex mutex;
+        std::vector<std::vector<Entry> > queue;
+        std::map<Glib::Thread*,gsize> current;
+
+        // the print(), error(), info() and debug() functions to restore:
+        void (*previous[4]) (const String& msg);
+
+        void add (guint type, const String& msg);
+
+        static Messages* active;
+        static void queue_print (const String& msg) { active->add (0, msg); }
+        static void queue_error (const String& msg) { active->add (1, msg); }
+        static void queue_info (const String& msg)  { active->add (2, msg); }
+        static void queue_debug (const String& msg) { active->add (3, msg); }
+    };
+
+  }
+}
+
+#endif
+
@@ -380,7 +380,10 @@ namespace MR {
     {
       Exception::Lower _ES (1);
       MR::File::Dicom::QuickScan reader;
-      if (reader.read (path)) return;
+      {
+        Exception::Lower l (2);
+        if (reader.read (path)) return;
+      }
 
       RefPtr<MR::File::Dicom::Patient> patient = dicom_tree.find (reader.patient, reader.patient_ID, reader.patient_DOB);
       RefPtr<MR::File::Dicom::Study> study = patient->find (reader.study, reader.study_ID, reader.study_date, reader.study_time);
@@ -0,0 +1,88 @@
+/*
+    Copyright 2008 Brain Research Institute, Melbourne, Australia
+
+    Written by J-Donald Tournier, 27/06/08.
+
+    This file is part of MRtrix.
+
+    MRtrix is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    MRtrix is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with MRtrix.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef __dwi_tractography_downsampler_h__
+#define __dwi_tractography_downsampler_h__
+
+#include "point.h"
+
+namespace MR {
+  namespace DWI {
+    namespace Tractography {
+
+      //! removes nearly collinear points from a streamline
+      /*! A point is dropped if the straight segment joining the last point
+       * retained to the next candidate point stays within \a tolerance (in mm)
+       * of all the points skipped in between. The distance between consecutive
+       * points retained never exceeds \a max_step, so that downstream commands
+       * can still rely on a bounded spacing (stored as "max_step_size" in the
+       * tracks file header). */
+      class Downsampler {
+        public:
+          Downsampler (float tolerance = 0.0, float max_step = 0.0) : tol2 (tolerance*tolerance), max_step2 (max_step*max_step), tol (tolerance), step (max_step) { }
+
+          bool  active () const    { return (tol > 0.0); }
+          float tolerance () const { return (tol); }
+          float max_step () const  { return (step); }
+
+          void operator() (const std::vector<Point>& in, std::vector<Point>& out) const
+          {
+            out.clear();
+            if (in.size() < 3) { out = in; return; }
+
+            guint anchor = 0;
+            out.push_back (in[0]);
+            for (guint n = 2; n < in.size(); ++n) {
+              if (!can_skip (in, anchor, n)) {
+                anchor = n-1;
+                out.push_back (in[anchor]);
+              }
+            }
+            out.push_back (in.back());
+          }
+
+        protected:
+          float tol2, max_step2, tol, step;
+
+          bool can_skip (const std::vector<Point>& in, guint anchor, guint end) const
+          {
+            const Point& a (in[anchor]);
+            Point d (in[end] - a);
+            float len2 = d.norm2();
+            if (max_step2 > 0.0 && len2 > max_step2) return (false);
+            for (guint n = anchor+1; n < end; ++n) {
+              Point p (in[n] - a);
+              float t = len2 > 0.0 ? p.dot (d) / len2 : 0.0;
+              if (t < 0.0) t = 0.0;
+              else if (t > 1.0) t = 1.0;
+              if ((p - t*d).norm2() > tol2) return (false);
+            }
+            return (true);
+          }
+      };
+
+    }
+  }
+}
+
+#endif
+
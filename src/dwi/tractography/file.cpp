@@ -159,8 +159,14 @@ namespace MR {
         if (!out) throw Exception ("error creating tracks file \"" + file + "\": " + Glib::strerror (errno));
 
         out << "mrtrix tracks\nEND\n";
-        for (Properties::const_iterator i = properties.begin(); i != properties.end(); ++i) 
+        for (Properties::const_iterator i = properties.begin(); i != properties.end(); ++i) {
+          if (downsampler.active() && ( i->first == "downsample_tolerance" || i->first == "max_step_size" )) continue;
           out << i->first << ": " << i->second << "\n";
+        }
+        if (downsampler.active()) {
+          out << "downsample_tolerance: " << downsampler.tolerance() << "\n";
+          out << "max_step_size: " << downsampler.max_step() << "\n";
+        }
 
         for (std::vector<String>::const_iterator i = properties.comments.begin(); i != properties.comments.end(); ++i)
           out << "comment: " << *i << "\n";
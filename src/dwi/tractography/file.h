@@ -29,6 +29,7 @@
 #include "file/key_value.h"
 #include "dwi/tractography/properties.h"
 #include "dwi/tractography/mds.h"
+#include "dwi/tractography/downsampler.h"
 
 namespace MR {
   namespace DWI {
@@ -64,8 +65,31 @@ namespace MR {
         public:
           Writer () : count (0), total_count (0), dtype (DataType::Float32) { dtype.set_byte_order_native(); }
 
+          //! enable collinearity-based downsampling of the tracks appended
+          /*! This must be called before create(), so that the corresponding
+           * entries can be written to the header. */
+          void set_downsampling (float tolerance, float max_step) { downsampler = Downsampler (tolerance, max_step); }
           void create (const String& file, const Properties& properties);
           void append (const std::vector<Point>& tck)
+          {
+            if (downsampler.active()) {
+              downsampler (tck, buffer);
+              write (buffer);
+            }
+            else write (tck);
+          }
+          void close ();
+
+          guint count, total_count;
+
+        protected:
+          std::ofstream  out;
+          DataType dtype;
+          goffset  count_offset;
+          Downsampler downsampler;
+          std::vector<Point> buffer;
+
+          void write (const std::vector<Point>& tck)
           {
             goffset current (out.tellp());
             current -= 3*sizeof(float);
@@ -84,14 +108,6 @@ namespace MR {
             
             count++;
           }
-          void close ();
-
-          guint count, total_count;
-
-        protected:
-          std::ofstream  out;
-          DataType dtype;
-          goffset  count_offset;
 
           void write_next_point (const Point& p) 
           {
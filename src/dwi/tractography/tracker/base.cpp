@@ -70,6 +70,9 @@ namespace MR {
           if (props["no_mask_interp"].empty()) { no_mask_interp = false; props["no_mask_interp"] = "0"; } 
           else no_mask_interp = to<bool> (props["no_mask_interp"]);
 
+          if (props["rng"].empty()) props["rng"] = "xoshiro";
+          rng.set_type (Math::RNG::type_from_name (props["rng"]));
+
           float max_dist = 200.0;
           if (props["max_dist"].empty()) props["max_dist"] = str(max_dist); else max_dist = to<float> (props["max_dist"]);
           num_max = round (max_dist/step_size);
@@ -31,6 +31,7 @@
 #include "dwi/tractography/tracker/dt_stream.h"
 #include "dwi/gradient.h"
 #include "math/linalg.h"
+#include "image/slab_product.h"
 
 namespace MR {
   namespace DWI {
@@ -40,8 +41,7 @@ namespace MR {
         DTStream::DTStream (Image::Object& source_image, Properties& properties, const Math::Matrix& inverse_bmat) : 
           Base (source_image, properties), 
           binv (inverse_bmat),
-          V(3,3), 
-          D(3,3)
+          precomputed (false)
         {
           float min_curv = 2.0; 
 
@@ -52,14 +52,40 @@ namespace MR {
           if (binv.rows() != 7 || binv.columns() < 7) 
             throw Exception ("unexpected diffusion b-matrix dimensions");
 
-          if (source.dim(3) != (int) binv.columns()) 
+          Properties::const_iterator dt_precomputed = props.find ("dt_precomputed");
+          if (dt_precomputed != props.end()) precomputed = to<bool> (dt_precomputed->second);
+
+          if (precomputed) {
+            if (source.dim(3) != 6) 
+              throw Exception ("expected 6 volumes in pre-computed tensor field");
+          }
+          else if (source.dim(3) != (int) binv.columns()) 
             throw Exception ("number of studies in base image does not match that in encoding file");
 
 
           min_dp = cos (curv2angle (step_size, min_curv));
+        }
+
+
+
+
+
+        void DTStream::fit_tensor_field (Image::Object& dwi, const Math::Matrix& inverse_bmat, Image::Object& tensors)
+        {
+          if (dwi.dim(3) != (int) inverse_bmat.columns()) 
+            throw Exception ("number of studies in base image does not match that in encoding file");
 
-          eigen_values = gsl_vector_alloc (3);
-          eigv_work = gsl_eigen_symmv_alloc (3);
+          Image::Header header (dwi.header());
+          header.axes.dim[3] = 6;
+          header.data_type = DataType::Float32;
+          header.DW_scheme.reset();
+          tensors.create ("", header);
+
+          Image::SlabProduct fitter (dwi, tensors, inverse_bmat);
+          fitter.set_log ();
+          // a NaN tensor would leave the tracker with an undefined direction:
+          fitter.set_substitute_non_finite ();
+          fitter.run ("fitting tensor field...");
         }
 
 
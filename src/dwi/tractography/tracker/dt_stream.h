@@ -27,11 +27,9 @@
 #ifndef __dwi_tractography_tracker_dt_stream_h__
 #define __dwi_tractography_tracker_dt_stream_h__
 
-#include <gsl/gsl_eigen.h>
-#include <gsl/gsl_sort_vector.h>
-
 #include "dwi/tractography/tracker/base.h"
 #include "dwi/tensor.h"
+#include "math/eig3.h"
 
 namespace MR {
   namespace DWI {
@@ -41,18 +39,22 @@ namespace MR {
         class DTStream : public Base {
           public:
             DTStream (Image::Object& source_image, Properties& properties, const Math::Matrix& inverse_bmat);
-            ~DTStream () { gsl_eigen_symmv_free (eigv_work); gsl_vector_free (eigen_values); }
+
+            //! fit the diffusion tensor in every voxel of \a dwi into the 6 volumes of \a tensors
+            /*! The tensors are fitted across multiple threads. If the
+             * resulting image is passed to the constructor as the source
+             * image, with the "dt_precomputed" property set, only the 6
+             * tensor components need to be interpolated at each step, rather
+             * than all the DW volumes. */
+            static void   fit_tensor_field (Image::Object& dwi, const Math::Matrix& inverse_bmat, Image::Object& tensors);
 
           protected:
             virtual bool  init_direction (const Point& seed_dir);
             virtual bool  next_point ();
 
             const Math::Matrix& binv;
-            Math::Matrix  V, D;
             float         min_dp;
-
-            gsl_vector*                 eigen_values;
-            gsl_eigen_symmv_workspace*  eigv_work;
+            bool          precomputed;
 
             float         get_EV (const Point& p);
         };
@@ -68,29 +70,28 @@ namespace MR {
         {
           if (get_source_data (p)) return (-1.0);
 
-          for (int n = 0; n < source.dim(3); n++) 
-            values[n] = values[n] > 0.0 ? -log (values[n]) : 1e-12;
-
           float dt[6];
-          for (int n = 0; n < 6; n++) {
-            dt[n] = 0.0;
-            for (int i = 0; i < source.dim(3); i++)
-              dt[n] += (float) (binv(n, i) * values[i]);
+          if (precomputed) {
+            for (int n = 0; n < 6; n++) 
+              dt[n] = values[n];
+          }
+          else {
+            for (int n = 0; n < source.dim(3); n++) 
+              values[n] = values[n] > 0.0 ? -log (values[n]) : 1e-12;
+
+            for (int n = 0; n < 6; n++) {
+              dt[n] = 0.0;
+              for (int i = 0; i < source.dim(3); i++)
+                dt[n] += (float) (binv(n, i) * values[i]);
+            }
           }
 
-          D(0,0) = dt[0];
-          D(1,1) = dt[1];
-          D(2,2) = dt[2];
-          D(0,1) = D(1,0) = dt[3];
-          D(0,2) = D(2,0) = dt[4];
-          D(1,2) = D(2,1) = dt[5]; 
-
-          gsl_eigen_symmv (D.get_gsl_matrix(), eigen_values, V.get_gsl_matrix(), eigv_work);
-          gsl_eigen_symmv_sort (eigen_values, V.get_gsl_matrix(), GSL_EIGEN_SORT_VAL_ASC);
+          double eigen_values[3], V[3][3];
+          Math::eig3 (dt, eigen_values, V);
 
-          dir[0] = V(0,2);
-          dir[1] = V(1,2);
-          dir[2] = V(2,2);
+          dir[0] = V[0][2];
+          dir[1] = V[1][2];
+          dir[2] = V[2][2];
 
           return (tensor2FA (dt));
         }
@@ -61,8 +61,7 @@ namespace MR {
 
           if (!seed_dir) {
             for (int n = 0; n < max_trials; n++) {
-              dir.set (rng.normal(), rng.normal(), rng.normal());
-              dir.normalise();
+              rng.random_unit_vectors (dir.get(), 1);
               float val = SH_amplitude (dir); 
               if (!gsl_isnan (val)) if (val > init_threshold) return (false);
             } 
@@ -84,8 +83,9 @@ namespace MR {
           if (get_source_data (pos)) return (true);
 
           float max_val = 0.0;
-          for (int n = 0; n < 12; n++) {
-            Point new_dir = new_rand_dir();
+          rng.fill_uniform (uniforms, 2*SDPROB_BATCH);
+          for (int n = 0; n < SDPROB_BATCH; n++) {
+            Point new_dir = new_rand_dir (uniforms + 2*n);
             float val = SH_amplitude (new_dir);
             if (val > max_val) max_val = val;
           }
@@ -95,11 +95,13 @@ namespace MR {
           max_val *= 1.5;
 
           for (int n = 0; n < max_trials; n++) {
-            Point new_dir = new_rand_dir();
+            const float* u = uniforms + 3*(n % SDPROB_BATCH);
+            if (u == uniforms) rng.fill_uniform (uniforms, 3*SDPROB_BATCH);
+            Point new_dir = new_rand_dir (u);
             float val = SH_amplitude (new_dir); 
             if (val > threshold) {
               if (val > max_val) info ("max_val exceeded!!! (val = " + str(val) + ", max_val = " + str (max_val) + ")");
-              if (rng.uniform() < val/max_val) {
+              if (u[2] < val/max_val) {
                 dir = new_dir;
                 return (false);
               }
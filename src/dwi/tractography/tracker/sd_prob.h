@@ -26,6 +26,8 @@
 #include "dwi/tractography/tracker/base.h"
 #include "dwi/SH.h"
 
+#define SDPROB_BATCH 12
+
 namespace MR {
   namespace DWI {
     namespace Tractography {
@@ -40,6 +42,10 @@ namespace MR {
             int   lmax, max_trials;
             bool  precomputed;
 
+            // the uniform deviates for a batch of SDPROB_BATCH trial directions,
+            // 2 for the direction and 1 for the rejection test:
+            float uniforms[3*SDPROB_BATCH];
+
             virtual bool  init_direction (const Point& seed_dir);
             virtual bool  next_point ();
 
@@ -49,23 +55,22 @@ namespace MR {
                 SH::value (&values[0], dir, lmax) );
             }
 
-            Point         new_rand_dir ();
+            Point         new_rand_dir (const float* u);
         };
 
 
 
 
 
-        inline Point SDProb::new_rand_dir ()
+        // a direction within dist_spread of the current direction, uniformly
+        // distributed over the disc, given 2 uniform deviates:
+        inline Point SDProb::new_rand_dir (const float* u)
         {
           float v[3];
-          do { 
-            v[0] = 2.0*rng.uniform() - 1.0; 
-            v[1] = 2.0*rng.uniform() - 1.0; 
-          } while (v[0]*v[0] + v[1]*v[1] > 1.0); 
-
-          v[0] *= dist_spread;
-          v[1] *= dist_spread;
+          const float r = dist_spread * sqrt (u[0]);
+          const float phi = 2.0 * M_PI * u[1];
+          v[0] = r * cos (phi);
+          v[1] = r * sin (phi);
           v[2] = 1.0 - (v[0]*v[0] + v[1]*v[1]);
           v[2] = v[2] < 0.0 ? 0.0 : sqrt (v[2]);
 
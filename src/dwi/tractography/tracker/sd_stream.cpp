@@ -59,9 +59,8 @@ namespace MR {
         {
           if (get_source_data (pos)) return (true);
 
-          if (!seed_dir) dir.set (rng.normal(), rng.normal(), rng.normal());
-          else dir = seed_dir;
-          dir.normalise();
+          if (!seed_dir) rng.random_unit_vectors (dir.get(), 1);
+          else { dir = seed_dir; dir.normalise(); }
           float val = SH::get_peak (&values[0], lmax, dir, precomputed);
           if (gsl_finite (val)) if (val > init_threshold) return (false);
           return (true);